@@ -3,37 +3,115 @@
 // SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
 // Luis Waucquez (luis.waucquez.jimenez@upm.es)
 
+// BRAM sized from NumWords/DataWidth (XPM), so the banks follow the memory map
+// derived from configs/addr.hjson. Byte writes when DataWidth is a multiple of
+// 8, word writes otherwise (SECDED banks write full codewords).
+
 module sram_wrapper #(
     parameter int unsigned NumWords = 32'd1024,  // Number of Words in data array
     parameter int unsigned DataWidth = 32'd32,  // Data signal width
+    parameter int unsigned NumPorts = 32'd1,  // 1 or 2 (BRAM true dual port)
     // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
-    parameter int unsigned AddrWidth = (NumWords > 32'd1) ? $clog2(NumWords) : 32'd1
+    parameter int unsigned AddrWidth = (NumWords > 32'd1) ? $clog2(NumWords) : 32'd1,
+    parameter int unsigned BeWidth = (DataWidth + 32'd7) / 32'd8
 ) (
     input logic clk_i,
     input logic rst_ni,
     // input ports
-    input logic req_i,
-    input logic we_i,
-    input logic [AddrWidth-1:0] addr_i,
-    input logic [31:0] wdata_i,
-    input logic [3:0] be_i,
+    input logic [NumPorts-1:0] req_i,
+    input logic [NumPorts-1:0] we_i,
+    input logic [NumPorts-1:0][AddrWidth-1:0] addr_i,
+    input logic [NumPorts-1:0][DataWidth-1:0] wdata_i,
+    input logic [NumPorts-1:0][BeWidth-1:0] be_i,
     // power manager signals that goes to the ASIC macros
     input logic pwrgate_ni,
     output logic pwrgate_ack_no,
     input logic set_retentive_ni,
     // output ports
-    output logic [31:0] rdata_o
+    output logic [NumPorts-1:0][DataWidth-1:0] rdata_o
 );
 
+  localparam bit ByteWrite = (DataWidth % 8) == 0;
+  localparam int unsigned WeWidth = ByteWrite ? BeWidth : 1;
+  localparam int unsigned WriteWidth = ByteWrite ? 8 : DataWidth;
+
+  logic [NumPorts-1:0][WeWidth-1:0] we;
+
   assign pwrgate_ack_no = pwrgate_ni;
-  xilinx_mem_gen_8192 tc_ram_i (
-      .clka (clk_i),
-      .ena  (req_i),
-      .wea  ({4{req_i & we_i}} & be_i),
-      .addra(addr_i),
-      .dina (wdata_i),
-      // output ports
-      .douta(rdata_o)
-  );
+
+  for (genvar p = 0; p < NumPorts; p++) begin : gen_we
+    assign we[p] = {WeWidth{req_i[p] & we_i[p]}} & (ByteWrite ? WeWidth'(be_i[p]) : WeWidth'(be_i[p][0]));
+  end
+
+  if (NumPorts == 2) begin : gen_tdp
+    xpm_memory_tdpram #(
+        .ADDR_WIDTH_A       (AddrWidth),
+        .ADDR_WIDTH_B       (AddrWidth),
+        .BYTE_WRITE_WIDTH_A (WriteWidth),
+        .BYTE_WRITE_WIDTH_B (WriteWidth),
+        .CLOCKING_MODE      ("common_clock"),
+        .MEMORY_PRIMITIVE   ("block"),
+        .MEMORY_SIZE        (NumWords * DataWidth),
+        .READ_DATA_WIDTH_A  (DataWidth),
+        .READ_DATA_WIDTH_B  (DataWidth),
+        .READ_LATENCY_A     (1),
+        .READ_LATENCY_B     (1),
+        .WRITE_DATA_WIDTH_A (DataWidth),
+        .WRITE_DATA_WIDTH_B (DataWidth),
+        .WRITE_MODE_A       ("read_first"),
+        .WRITE_MODE_B       ("read_first")
+    ) tc_ram_i (
+        .clka          (clk_i),
+        .rsta          (1'b0),
+        .ena           (req_i[0]),
+        .regcea        (1'b1),
+        .wea           (we[0]),
+        .addra         (addr_i[0]),
+        .dina          (wdata_i[0]),
+        .douta         (rdata_o[0]),
+        .clkb          (clk_i),
+        .rstb          (1'b0),
+        .enb           (req_i[1]),
+        .regceb        (1'b1),
+        .web           (we[1]),
+        .addrb         (addr_i[1]),
+        .dinb          (wdata_i[1]),
+        .doutb         (rdata_o[1]),
+        .sleep         (1'b0),
+        .injectsbiterra(1'b0),
+        .injectdbiterra(1'b0),
+        .injectsbiterrb(1'b0),
+        .injectdbiterrb(1'b0),
+        .sbiterra      (),
+        .dbiterra      (),
+        .sbiterrb      (),
+        .dbiterrb      ()
+    );
+  end else begin : gen_sp
+    xpm_memory_spram #(
+        .ADDR_WIDTH_A       (AddrWidth),
+        .BYTE_WRITE_WIDTH_A (WriteWidth),
+        .MEMORY_PRIMITIVE   ("block"),
+        .MEMORY_SIZE        (NumWords * DataWidth),
+        .READ_DATA_WIDTH_A  (DataWidth),
+        .READ_LATENCY_A     (1),
+        .WRITE_DATA_WIDTH_A (DataWidth),
+        .WRITE_MODE_A       ("read_first")
+    ) tc_ram_i (
+        .clka          (clk_i),
+        .rsta          (1'b0),
+        .ena           (req_i[0]),
+        .regcea        (1'b1),
+        .wea           (we[0]),
+        .addra         (addr_i[0]),
+        .dina          (wdata_i[0]),
+        .douta         (rdata_o[0]),
+        .sleep         (1'b0),
+        .injectsbiterra(1'b0),
+        .injectdbiterra(1'b0),
+        .sbiterra      (),
+        .dbiterra      ()
+    );
+  end
 
 endmodule
@@ -12,6 +12,10 @@ uint32_t reset_vec[reset_vec_size] = {
     0x00000013,
     0x00000013,
     0x20000537,
+    0x04c52403,
+    0x00040663,
+    0x05052503,
+    0x0080006f,
     0x02452503,
     0x7b151073,
     0x7b200073,
@@ -19,10 +23,6 @@ uint32_t reset_vec[reset_vec_size] = {
     0x13000000,
     0x13000000,
     0x13000000,
-    0x13000000,
-    0x13000000,
-    0x13000000,
-    0x13000000,
     0x7b351073,
     0x7b241073,
     0x20000537,
@@ -138,13 +138,13 @@ module CB_boot_rom
     32'h13000000,
     32'h13000000,
     32'h13000000,
-    32'h13000000,
-    32'h13000000,
-    32'h13000000,
-    32'h13000000,
     32'h7b200073,
     32'h7b151073,
     32'h02452503,
+    32'h0080006f,
+    32'h05052503,
+    32'h00040663,
+    32'h04c52403,
     32'h20000537,
     32'h00000013,
     32'h00000013,
@@ -27,8 +27,8 @@ module bus_system
 #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NHARTS  = 3,
-    parameter N_BANKS = 2
+    parameter NHARTS  = sap_pkg::NHARTS,
+    parameter N_BANKS = sap_pkg::NUM_BANKS
 ) (
     input logic clk_i,
     input logic rst_ni,
@@ -48,6 +48,10 @@ module bus_system
     input  obi_req_t  ext_master_req_i,
     output obi_resp_t ext_master_resp_o,
 
+    //DMA master
+    input  obi_req_t  dma_master_req_i,
+    output obi_resp_t dma_master_resp_o,
+
     //CSR
     input  reg_req_t ext_csr_reg_req_i,
     output reg_rsp_t ext_csr_reg_resp_o,
@@ -57,8 +61,11 @@ module bus_system
     input  obi_resp_t ext_slave_resp_i,
 
     //Ram memory
-    output obi_req_t  [N_BANKS-1:0] ram_req_o,
-    input  obi_resp_t [N_BANKS-1:0] ram_resp_i,
+    output obi_req_t  [N_BANKS*sap_pkg::MEM_PORTS-1:0] ram_req_o,
+    input  obi_resp_t [N_BANKS*sap_pkg::MEM_PORTS-1:0] ram_resp_i,
+
+    // System xbar QoS
+    input sap_pkg::xbar_qos_t xbar_qos_i,
 
     // Control Status Register Output
     output reg_req_t wrapper_csr_req_o,
@@ -76,9 +83,15 @@ module bus_system
   reg_pkg::reg_rsp_t [1:0] int_rsp;
 
 
-  // Demux CPU Data
-  obi_req_t     [NHARTS-1:0][1:0] demux_core_data_req;
-  obi_resp_t    [NHARTS-1:0][1:0] demux_core_data_resp;
+  // Demux CPU Data (system xbar, safe CPU register and TCM when enabled)
+  localparam int unsigned DemuxNSlave = sap_pkg::TCM_ENABLE ? 32'd3 : 32'd2;
+
+  obi_req_t     [NHARTS-1:0][DemuxNSlave-1:0] demux_core_data_req;
+  obi_resp_t    [NHARTS-1:0][DemuxNSlave-1:0] demux_core_data_resp;
+  obi_req_t     [NHARTS-1:0] instr_req;
+  obi_resp_t    [NHARTS-1:0] instr_resp;
+  obi_req_t     [NHARTS-1:0] xbar_core_instr_req;
+  obi_resp_t    [NHARTS-1:0] xbar_core_instr_resp;
   obi_req_t     int_wrapper_csr_req;
   obi_resp_t    int_wrapper_csr_resp;
   obi_req_t     [NHARTS-1:0] int_obi_wrapper_csr_req;
@@ -93,28 +106,26 @@ module bus_system
   obi_resp_t [sap_pkg::SYSTEM_XBAR_NSLAVE-1:0] int_slave_resp;
 
   // Internal master requests
-  assign int_master_req[sap_pkg::CORE0_INSTR_IDX] = core_instr_req_i[0];
-  assign int_master_req[sap_pkg::CORE0_DATA_IDX] = demux_core_data_req[0][0];
-  assign int_master_req[sap_pkg::CORE1_INSTR_IDX] = core_instr_req_i[1];
-  assign int_master_req[sap_pkg::CORE1_DATA_IDX] = demux_core_data_req[1][0];
-  assign int_master_req[sap_pkg::CORE2_INSTR_IDX] = core_instr_req_i[2];
-  assign int_master_req[sap_pkg::CORE2_DATA_IDX] = demux_core_data_req[2][0];
+  for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_core_master
+    assign int_master_req[sap_pkg::core_instr_idx(i)] = xbar_core_instr_req[i];
+    assign int_master_req[sap_pkg::core_data_idx(i)] = demux_core_data_req[i][0];
+    assign xbar_core_instr_resp[i] = int_master_resp[sap_pkg::core_instr_idx(i)];
+    assign demux_core_data_resp[i][0] = int_master_resp[sap_pkg::core_data_idx(i)];
+  end
   assign int_master_req[sap_pkg::EXTERNAL_MASTER_IDX] = ext_master_req_i;
+  assign int_master_req[sap_pkg::DMA_MASTER_IDX] = dma_master_req_i;
 
-  // Internal master responses
-  assign core_instr_resp_o[0] = int_master_resp[sap_pkg::CORE0_INSTR_IDX];
-  assign demux_core_data_resp[0][0] = int_master_resp[sap_pkg::CORE0_DATA_IDX];
-  assign core_instr_resp_o[1] = int_master_resp[sap_pkg::CORE1_INSTR_IDX];
-  assign demux_core_data_resp[1][0] = int_master_resp[sap_pkg::CORE1_DATA_IDX];
-  assign core_instr_resp_o[2] = int_master_resp[sap_pkg::CORE2_INSTR_IDX];
-  assign demux_core_data_resp[2][0] = int_master_resp[sap_pkg::CORE2_DATA_IDX];
   // External master responses
   assign ext_master_resp_o = int_master_resp[sap_pkg::EXTERNAL_MASTER_IDX];
+  // DMA master responses
+  assign dma_master_resp_o = int_master_resp[sap_pkg::DMA_MASTER_IDX];
 
   // Internal slave requests
   assign peripheral_slave_req_o = int_slave_req[sap_pkg::PERIPHERAL_IDX];
-  assign ram_req_o[0] = int_slave_req[sap_pkg::MEMORY_RAM0_IDX];
-  assign ram_req_o[1] = int_slave_req[sap_pkg::MEMORY_RAM1_IDX];
+  for (genvar i = 0; i < N_BANKS * sap_pkg::MEM_PORTS; i++) begin : gen_ram_req
+    assign ram_req_o[i] = int_slave_req[sap_pkg::MEMORY_RAM0_IDX+i];
+    assign int_slave_resp[sap_pkg::MEMORY_RAM0_IDX+i] = ram_resp_i[i];
+  end
 //  assign int_wrapper_csr_req = int_slave_req[sap_pkg::SAFE_CPU_REGISTER_IDX];
 
   // External slave requests
@@ -122,8 +133,6 @@ module bus_system
 
   // Internal slave responses
   assign int_slave_resp[sap_pkg::PERIPHERAL_IDX] = peripheral_slave_resp_i;
-  assign int_slave_resp[sap_pkg::MEMORY_RAM0_IDX] = ram_resp_i[0];
-  assign int_slave_resp[sap_pkg::MEMORY_RAM1_IDX] = ram_resp_i[1];
 //  assign int_slave_resp[sap_pkg::SAFE_CPU_REGISTER_IDX] = int_wrapper_csr_resp;
   // External slave responses
   assign int_slave_resp[sap_pkg::EXTERNAL_PERIPHERAL_IDX] = ext_slave_resp_i;
@@ -133,12 +142,17 @@ module bus_system
       .obi_req_t            (obi_req_t  ),
       .obi_resp_t           (obi_resp_t ),
       .XBAR_NMASTER(sap_pkg::SYSTEM_XBAR_NMASTER),
-      .XBAR_NSLAVE (sap_pkg::SYSTEM_XBAR_NSLAVE)
+      .XBAR_NSLAVE (sap_pkg::SYSTEM_XBAR_NSLAVE),
+      .NUM_RULES   (sap_pkg::SYSTEM_XBAR_NRULES)
   ) xbar_system_i (
       .clk_i(clk_i),
       .rst_ni(rst_ni),
       .addr_map_i(sap_pkg::XBAR_ADDR_RULES),
       .default_idx_i(sap_pkg::ERROR_IDX[LOG_SYSTEM_XBAR_NSLAVE-1:0]),
+      .qos_prio_i(xbar_qos_i.prio),
+      .qos_weight_i(xbar_qos_i.weight),
+      .qos_bw_window_i(xbar_qos_i.bw_window),
+      .qos_bw_cap_i(xbar_qos_i.bw_cap),
       .master_req_i(int_master_req),
       .master_resp_o(int_master_resp),
       .slave_req_o(int_slave_req),
@@ -154,30 +168,184 @@ module bus_system
     // CPU_DATAx <--> XBARx
     //                `---- SLAVE[1] (Safe CPU Register)
     //
-    assign demux_core_data_resp[0][1] = int_obi_wrapper_csr_resp[0];
-    assign demux_core_data_resp[1][1] = int_obi_wrapper_csr_resp[1];
-    assign demux_core_data_resp[2][1] = int_obi_wrapper_csr_resp[2];
+    // Every hart reaches the block of its own redundancy group at
+    // SAFE_CPU_REGISTER_START_ADDRESS, moved here to group * SAFE_CPU_REGISTER_SIZE
+    for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_csr_group
+      always_comb begin
+        int_obi_wrapper_csr_req[i] = demux_core_data_req[i][1];
+        int_obi_wrapper_csr_req[i].addr = demux_core_data_req[i][1].addr +
+            (i / sap_pkg::HARTS_PER_GROUP) * sap_pkg::SAFE_CPU_REGISTER_SIZE;
+      end
+      assign demux_core_data_resp[i][1] = int_obi_wrapper_csr_resp[i];
+    end
+
+    //***Boot ROM instruction port***//
 
-    assign int_obi_wrapper_csr_req[0] = demux_core_data_req[0][1];
-    assign int_obi_wrapper_csr_req[1] = demux_core_data_req[1][1];
-    assign int_obi_wrapper_csr_req[2] = demux_core_data_req[2][1];
+    // ARCHITECTURE
+    // ------------
+    //                 ,---- SLAVE[0] (TCM demux / System Bus)
+    // CPU_INSTRx <--> XBARx
+    //                 `---- SLAVE[1] (Boot ROM, per hart or shared)
+    //
+    if (sap_pkg::BOOTROM_PORT) begin : gen_rom_port
+      obi_req_t  [NHARTS-1:0][1:0] demux_rom_req;
+      obi_resp_t [NHARTS-1:0][1:0] demux_rom_resp;
+
+      for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_rom_demux
+        sap_xbar_varlat_one_to_n #(
+            .obi_req_t            (obi_req_t  ),
+            .obi_resp_t           (obi_resp_t ),
+            .XBAR_NSLAVE(32'd2),  // instruction path + boot ROM
+            .NUM_RULES  (32'd1)
+        ) demux_rom_xbar_i (
+            .clk_i        (clk_i),
+            .rst_ni       (rst_ni),
+            .addr_map_i   (DEMUX_INSTR_ROM_ADDR_RULES),
+            .default_idx_i(DEMUX_INT_XBAR_IDX[0:0]),
+            .master_req_i (core_instr_req_i[i]),
+            .master_resp_o(core_instr_resp_o[i]),
+            .slave_req_o  (demux_rom_req[i]),
+            .slave_resp_i (demux_rom_resp[i])
+        );
+
+        assign instr_req[i] = demux_rom_req[i][DEMUX_INT_XBAR_IDX];
+        assign demux_rom_resp[i][DEMUX_INT_XBAR_IDX] = instr_resp[i];
+      end
+
+      if (sap_pkg::BOOTROM_PER_HART) begin : gen_rom_per_hart
+        for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_rom
+          sap_boot_rom #(
+              .obi_req_t (obi_req_t),
+              .obi_resp_t(obi_resp_t)
+          ) boot_rom_i (
+              .clk_i,
+              .rst_ni,
+              .req_i (demux_rom_req[i][DEMUX_INSTR_ROM_IDX]),
+              .resp_o(demux_rom_resp[i][DEMUX_INSTR_ROM_IDX])
+          );
+        end
+      end else begin : gen_rom_shared
+        obi_req_t  [NHARTS-1:0] rom_master_req;
+        obi_resp_t [NHARTS-1:0] rom_master_resp;
+        obi_req_t  rom_req;
+        obi_resp_t rom_resp;
+
+        for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_rom_master
+          assign rom_master_req[i] = demux_rom_req[i][DEMUX_INSTR_ROM_IDX];
+          assign demux_rom_resp[i][DEMUX_INSTR_ROM_IDX] = rom_master_resp[i];
+        end
+
+        sap_xbar_varlat_n_to_one #(
+            .obi_req_t   (obi_req_t),
+            .obi_resp_t  (obi_resp_t),
+            .XBAR_NMASTER(NHARTS)
+        ) rom_mux_i (
+            .clk_i,
+            .rst_ni,
+            .rr_i         ('0),
+            .master_req_i (rom_master_req),
+            .master_resp_o(rom_master_resp),
+            .slave_req_o  (rom_req),
+            .slave_resp_i (rom_resp)
+        );
+
+        sap_boot_rom #(
+            .obi_req_t (obi_req_t),
+            .obi_resp_t(obi_resp_t)
+        ) boot_rom_i (
+            .clk_i,
+            .rst_ni,
+            .req_i (rom_req),
+            .resp_o(rom_resp)
+        );
+      end
+    end else begin : gen_no_rom_port
+      assign instr_req = core_instr_req_i;
+      assign core_instr_resp_o = instr_resp;
+    end
 
     for (genvar i = 0; unsigned'(i) < NHARTS; i++) begin : gen_demux
-      sap_xbar_varlat_one_to_n #(
-          .obi_req_t            (obi_req_t  ),
-          .obi_resp_t           (obi_resp_t ),
-          .XBAR_NSLAVE(32'd2),  // internal crossbar + external crossbar
-          .NUM_RULES  (32'd1)   // only the external address space is defined
-      ) demux_xbar_i (
-          .clk_i        (clk_i),
-          .rst_ni       (rst_ni),
-          .addr_map_i   (DEMUX_INT_SAFE_REG_ADDR_RULES),
-          .default_idx_i(DEMUX_INT_XBAR_IDX[0:0]),
-          .master_req_i (core_data_req_i[i]),
-          .master_resp_o(core_data_resp_o[i]),
-          .slave_req_o  (demux_core_data_req[i]),
-          .slave_resp_i (demux_core_data_resp[i])
-      );
+      if (sap_pkg::TCM_ENABLE) begin : gen_tcm
+
+        // ARCHITECTURE
+        // ------------
+        //                 ,---- SLAVE[0] (System Bus)
+        // CPU_INSTRx <--> XBARx
+        //                 `---- SLAVE[1] (TCM) <--- CPU_DATAx SLAVE[2]
+        //
+        obi_req_t  [1:0] demux_core_instr_req;
+        obi_resp_t [1:0] demux_core_instr_resp;
+
+        sap_xbar_varlat_one_to_n #(
+            .obi_req_t            (obi_req_t  ),
+            .obi_resp_t           (obi_resp_t ),
+            .XBAR_NSLAVE(32'd2),  // system crossbar + TCM
+            .NUM_RULES  (32'd1)
+        ) demux_instr_xbar_i (
+            .clk_i        (clk_i),
+            .rst_ni       (rst_ni),
+            .addr_map_i   (DEMUX_INSTR_TCM_ADDR_RULES),
+            .default_idx_i(DEMUX_INT_XBAR_IDX[0:0]),
+            .master_req_i (instr_req[i]),
+            .master_resp_o(instr_resp[i]),
+            .slave_req_o  (demux_core_instr_req),
+            .slave_resp_i (demux_core_instr_resp)
+        );
+
+        assign xbar_core_instr_req[i] = demux_core_instr_req[DEMUX_INT_XBAR_IDX];
+        assign demux_core_instr_resp[DEMUX_INT_XBAR_IDX] = xbar_core_instr_resp[i];
+
+        sap_xbar_varlat_one_to_n #(
+            .obi_req_t            (obi_req_t  ),
+            .obi_resp_t           (obi_resp_t ),
+            .XBAR_NSLAVE(32'd3),  // system crossbar + safe CPU register + TCM
+            .NUM_RULES  (32'd2)
+        ) demux_xbar_i (
+            .clk_i        (clk_i),
+            .rst_ni       (rst_ni),
+            .addr_map_i   (DEMUX_INT_SAFE_REG_TCM_ADDR_RULES),
+            .default_idx_i(DEMUX_INT_XBAR_IDX[1:0]),
+            .master_req_i (core_data_req_i[i]),
+            .master_resp_o(core_data_resp_o[i]),
+            .slave_req_o  (demux_core_data_req[i]),
+            .slave_resp_i (demux_core_data_resp[i])
+        );
+
+        sap_tcm #(
+            .obi_req_t (obi_req_t),
+            .obi_resp_t(obi_resp_t),
+            .SIZE      (TCM_SIZE)
+        ) tcm_i (
+            .clk_i,
+            .rst_ni,
+            .instr_req_i (demux_core_instr_req[DEMUX_INSTR_TCM_IDX]),
+            .instr_resp_o(demux_core_instr_resp[DEMUX_INSTR_TCM_IDX]),
+            .data_req_i  (demux_core_data_req[i][DEMUX_TCM_IDX]),
+            .data_resp_o (demux_core_data_resp[i][DEMUX_TCM_IDX])
+        );
+
+      end else begin : gen_no_tcm
+
+        assign xbar_core_instr_req[i] = instr_req[i];
+        assign instr_resp[i] = xbar_core_instr_resp[i];
+
+        sap_xbar_varlat_one_to_n #(
+            .obi_req_t            (obi_req_t  ),
+            .obi_resp_t           (obi_resp_t ),
+            .XBAR_NSLAVE(32'd2),  // internal crossbar + external crossbar
+            .NUM_RULES  (32'd1)   // only the external address space is defined
+        ) demux_xbar_i (
+            .clk_i        (clk_i),
+            .rst_ni       (rst_ni),
+            .addr_map_i   (DEMUX_INT_SAFE_REG_ADDR_RULES),
+            .default_idx_i(DEMUX_INT_XBAR_IDX[0:0]),
+            .master_req_i (core_data_req_i[i]),
+            .master_resp_o(core_data_resp_o[i]),
+            .slave_req_o  (demux_core_data_req[i]),
+            .slave_resp_i (demux_core_data_resp[i])
+        );
+
+      end
     end
 
 
@@ -189,6 +357,7 @@ module bus_system
     ) sap_xbar_varlat_n_to_one_data_i (
       .clk_i        (clk_i),
       .rst_ni       (rst_ni),
+      .rr_i         ('0),
       .master_req_i (int_obi_wrapper_csr_req),
       .master_resp_o(int_obi_wrapper_csr_resp),
       .slave_req_o  (int_wrapper_csr_req),
@@ -0,0 +1,57 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Relaxed checking of the voters/comparators outside critical sections
+// (Check_Policy), inside a critical section every transaction is checked.
+//  - stores_i: the data bus is only checked on stores, the instruction bus
+//    (control flow) is always checked.
+//  - sample_i: one transaction out of nth_i is checked on each bus, counted
+//    on the accepted requests of the master port.
+// Only addr, be and wdata are relaxed, req and we are always checked.
+// Unchecked transactions are still voted/forwarded, the harts keep pacing.
+
+module check_policy #(
+    parameter int unsigned NTH_WIDTH = 8
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input logic critical_i,
+    input logic stores_i,
+    input logic sample_i,
+    input logic [NTH_WIDTH-1:0] nth_i,
+
+    // Accepted requests of the master port
+    input logic instr_acc_i,
+    input logic data_acc_i,
+
+    output logic instr_check_o,
+    output logic data_check_o,
+    output logic load_check_o
+);
+
+  logic relaxed;
+  logic [NTH_WIDTH-1:0] instr_cnt_q, data_cnt_q;
+
+  assign relaxed = !critical_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      instr_cnt_q <= '0;
+      data_cnt_q  <= '0;
+    end else if (!relaxed || !sample_i) begin
+      instr_cnt_q <= '0;
+      data_cnt_q  <= '0;
+    end else begin
+      if (instr_acc_i) instr_cnt_q <= (instr_cnt_q + 1'b1 >= nth_i) ? '0 : instr_cnt_q + 1'b1;
+      if (data_acc_i) data_cnt_q <= (data_cnt_q + 1'b1 >= nth_i) ? '0 : data_cnt_q + 1'b1;
+    end
+  end
+
+  assign instr_check_o = !relaxed || !sample_i || (instr_cnt_q == '0);
+  assign data_check_o  = !relaxed || !sample_i || (data_cnt_q == '0);
+  assign load_check_o  = !relaxed || !stores_i;
+
+endmodule
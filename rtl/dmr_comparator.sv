@@ -3,70 +3,151 @@
 // SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
 // Luis Waucquez (luis.waucquez.jimenez@upm.es)
 /*
- *
- *
- *
+ * Comparator of the instruction and data requests of the two harts of a DMR
+ * pair; on a mismatch the request is gated. With PIPELINE the compared
+ * request and the error flag are registered (obi_sngreg), the harts are
+ * granted by the stage (core_*_gnt_o) instead of the bus. error_data_o
+ * flags a data request mismatch alone (dmr_tiebreak), error_field_o the
+ * differing fields ({wdata, be, we, addr, req}) and error_addr_o the address
+ * of the first hart on the erroneous bus (telemetry). check_policy may leave
+ * the addr, be and wdata of a transaction unchecked (instr_check_i/
+ * data_check_i, load_check_i low: data bus checked on stores only), it is
+ * forwarded from the first hart. req and we, hence the store decision, are
+ * always checked.
  */
 
 module dmr_comparator #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NHARTS = 2
+    parameter NHARTS = 2,
+    parameter bit PIPELINE = sap_pkg::VOTER_PIPELINE
 ) (
+    input logic clk_i,
+    input logic rst_ni,
+
     // Instruction Bus
     input obi_req_t [NHARTS-1 : 0] core_instr_req_i,
     output obi_req_t compared_core_instr_req_o,
+    input logic compared_core_instr_gnt_i,
+    output logic core_instr_gnt_o,
 
     // Data Bus
     input obi_req_t [NHARTS-1 : 0] core_data_req_i,
     output obi_req_t compared_core_data_req_o,
+    input logic compared_core_data_gnt_i,
+    output logic core_data_gnt_o,
+
+    // Relaxed checking
+    input logic instr_check_i,
+    input logic data_check_i,
+    input logic load_check_i,
 
-    output logic error_o
+    output logic error_o,
+    output logic error_data_o,
+    output logic [4:0] error_field_o,
+    output logic [31:0] error_addr_o
 );
 
   logic [1:0] error_s;
+  logic [4:0] instr_field_s, data_field_s;
+  logic [4:0] error_field_s;
+  logic [31:0] error_addr_s;
+  logic data_check_s;
+  obi_req_t gated_core_instr_req_s;
+  obi_req_t gated_core_data_req_s;
 
   //Checker
+  assign data_check_s = data_check_i && (load_check_i || (core_data_req_i[0].req && core_data_req_i[0].we) ||
+                                         (core_data_req_i[1].req && core_data_req_i[1].we));
 
   always_comb begin
-    error_s = '0;
     //Instruction
-    // Check only wdata if a addr request it s ordered
-    if (((core_instr_req_i[0].addr != core_instr_req_i[1].addr) & core_instr_req_i[0].req & core_instr_req_i[1].req) ||
-        // Check only wdata if a write request it s ordered
-        ((core_instr_req_i[0].wdata != core_instr_req_i[1].wdata) & core_instr_req_i[0].we & core_instr_req_i[1].we) ||
-            (core_instr_req_i[0].be != core_instr_req_i[1].be) ||
-            (core_instr_req_i[0].we != core_instr_req_i[1].we) ||
-            (core_instr_req_i[0].req != core_instr_req_i[1].req)) begin
-      error_s[0] = 1'b1;
-    end
+    // addr checked only under request, wdata only under write
+    instr_field_s = {
+      (core_instr_req_i[0].wdata != core_instr_req_i[1].wdata) & core_instr_req_i[0].we & core_instr_req_i[1].we,
+      (core_instr_req_i[0].be != core_instr_req_i[1].be),
+      (core_instr_req_i[0].we != core_instr_req_i[1].we),
+      (core_instr_req_i[0].addr != core_instr_req_i[1].addr) & core_instr_req_i[0].req & core_instr_req_i[1].req,
+      (core_instr_req_i[0].req != core_instr_req_i[1].req)
+    } & {{2{instr_check_i}}, 1'b1, instr_check_i, 1'b1};
     //Data
-    // Check only wdata if a addr request it s ordered
-    if (((core_data_req_i[0].addr != core_data_req_i[1].addr & core_data_req_i[0].req & core_data_req_i[1].req)) ||
-        // Check only wdata if a write request it s ordered
-        ((core_data_req_i[0].wdata != core_data_req_i[1].wdata) & core_data_req_i[0].we & core_data_req_i[1].we) ||
-            (core_data_req_i[0].be != core_data_req_i[1].be) ||
-            (core_data_req_i[0].we != core_data_req_i[1].we) ||
-            (core_data_req_i[0].req != core_data_req_i[1].req)) begin
-      error_s[1] = 1'b1;
-    end
+    // addr checked only under request, wdata only under write
+    data_field_s = {
+      (core_data_req_i[0].wdata != core_data_req_i[1].wdata) & core_data_req_i[0].we & core_data_req_i[1].we,
+      (core_data_req_i[0].be != core_data_req_i[1].be),
+      (core_data_req_i[0].we != core_data_req_i[1].we),
+      (core_data_req_i[0].addr != core_data_req_i[1].addr) & core_data_req_i[0].req & core_data_req_i[1].req,
+      (core_data_req_i[0].req != core_data_req_i[1].req)
+    } & {{2{data_check_s}}, 1'b1, data_check_s, 1'b1};
+    error_s[0] = |instr_field_s;
+    error_s[1] = |data_field_s;
   end
 
+  assign error_field_s = instr_field_s | data_field_s;
+  assign error_addr_s  = error_s[1] ? core_data_req_i[0].addr : core_instr_req_i[0].addr;
+
   //Gated-Output
   //Output is gated to ensure that an error does not propagate to the rest of the circuit.
   always_comb begin
     if (error_s[0] || error_s[1]) begin
-      compared_core_instr_req_o = '0;
-      compared_core_data_req_o  = '0;
+      gated_core_instr_req_s = '0;
+      gated_core_data_req_s  = '0;
     end else begin
-      compared_core_instr_req_o = core_instr_req_i[0];
-      compared_core_data_req_o  = core_data_req_i[0];
+      gated_core_instr_req_s = core_instr_req_i[0];
+      gated_core_data_req_s  = core_data_req_i[0];
     end
   end
 
-  assign error_o = error_s[0] | error_s[1];
+  if (PIPELINE) begin : gen_pipeline
+    //Register stage: a gated request is never granted, so it never enters the stage
+    obi_sngreg #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t)
+    ) obi_sngreg_instr_i (
+        .clk_i,
+        .rst_ni,
+        .clear_pipeline       (1'b0),
+        .core_instr_req_i     (gated_core_instr_req_s),
+        .core_instr_req_o     (compared_core_instr_req_o),
+        .core_instr_resp_gnt_i(compared_core_instr_gnt_i),
+        .core_instr_resp_gnt_o(core_instr_gnt_o)
+    );
 
+    obi_sngreg #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t)
+    ) obi_sngreg_data_i (
+        .clk_i,
+        .rst_ni,
+        .clear_pipeline       (1'b0),
+        .core_instr_req_i     (gated_core_data_req_s),
+        .core_instr_req_o     (compared_core_data_req_o),
+        .core_instr_resp_gnt_i(compared_core_data_gnt_i),
+        .core_instr_resp_gnt_o(core_data_gnt_o)
+    );
 
-endmodule
-
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        error_o <= 1'b0;
+        error_data_o <= 1'b0;
+        error_field_o <= '0;
+        error_addr_o <= '0;
+      end else begin
+        error_o <= error_s[0] | error_s[1];
+        error_data_o <= error_s[1];
+        error_field_o <= error_field_s;
+        error_addr_o <= error_addr_s;
+      end
+    end
+  end else begin : gen_no_pipeline
+    assign compared_core_instr_req_o = gated_core_instr_req_s;
+    assign compared_core_data_req_o = gated_core_data_req_s;
+    assign core_instr_gnt_o = compared_core_instr_gnt_i;
+    assign core_data_gnt_o = compared_core_data_gnt_i;
+    assign error_o = error_s[0] | error_s[1];
+    assign error_data_o = error_s[1];
+    assign error_field_o = error_field_s;
+    assign error_addr_o = error_addr_s;
+  end
 
+endmodule
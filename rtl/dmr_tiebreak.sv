@@ -0,0 +1,233 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Tie-break of a DCLS data mismatch with the idle third hart.
+//  - The data requests accepted by the comparator are counted from the last
+//    checkpoint (write to Dmr_Checkpoint at the end of Store_Checkpoint). On
+//    the first mismatch, if it is a data one, the count and both requests
+//    are latched.
+//  - start_i (safe_FSM DMR_TIEBREAK, pair isolated and asleep): the third
+//    hart is halted with the DMR_REC flag set, so halt_boot restores the
+//    last checkpoint, and runs from it on its own port. Its request number
+//    N is held and compared with the latched ones: the pair hart it agrees
+//    with is the healthy one.
+//  - Resolved: the held request is released and irq_o asks the third hart
+//    to store a new checkpoint (handler_dmr_tiebreak), the pair then resumes
+//    from it instead of the old one. Otherwise (no checkpoint, instruction
+//    mismatch, no agreement or timeout) the third hart is isolated and the
+//    pair rolls back as usual.
+
+module dmr_tiebreak #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter NHARTS = 3,
+    parameter logic [31:0] CKPT_ADDR = sap_pkg::SAFE_CPU_REGISTER_START_ADDRESS +
+                                       safe_wrapper_ctrl_reg_pkg::SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_OFFSET,
+    parameter int unsigned TIMEOUT = sap_pkg::DMR_TIEBREAK_TIMEOUT
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input logic enable_i,
+    input logic [NHARTS-1:0] master_i,
+    input logic [NHARTS-1:0] pair_i,
+
+    // Comparator of the pair
+    input obi_req_t [1:0] pair_req_i,
+    input logic pair_gnt_i,
+    input logic error_i,
+    input logic data_error_i,
+
+    // Hart side data requests (system bus)
+    input obi_req_t [NHARTS-1:0] core_data_req_i,
+    input logic [NHARTS-1:0] core_data_gnt_i,
+
+    // safe_FSM
+    input  logic start_i,
+    output logic done_o,
+    input  logic [NHARTS-1:0] halt_ack_i,
+    input  logic [NHARTS-1:0] sleep_i,
+
+    // Third hart control
+    output logic [NHARTS-1:0] hart_o,
+    output logic [NHARTS-1:0] halt_o,
+    output logic [NHARTS-1:0] hold_o,
+    output logic [NHARTS-1:0] irq_o,
+    output logic [NHARTS-1:0] isolate_o,
+    output logic rec_o,
+
+    // Status
+    output logic live_o,
+    output logic resolved_o,
+    output logic [NHARTS-1:0] faulty_o
+);
+
+  typedef enum logic [2:0] {
+    TB_IDLE,
+    TB_HALT,
+    TB_RESUME,
+    TB_RUN,
+    TB_LIVE,
+    TB_ISOLATE,
+    TB_DONE
+  } tb_state_e;
+
+  tb_state_e state_q, state_d;
+
+  logic [NHARTS-1:0] third;
+  obi_req_t third_req;
+  logic third_gnt;
+
+  //Pair: requests since the last checkpoint, latched on the first mismatch
+  logic [31:0] pair_cnt_q, cap_cnt_q;
+  logic pair_ckpt_q, cap_q, stale_q, cap_valid_q;
+  obi_req_t [1:0] cap_req_q;
+  logic pair_acc;
+
+  //Third hart
+  logic [31:0] run_cnt_q;
+  logic run_ckpt_q;
+  logic [31:0] timer_q;
+  logic timeout;
+  logic at_mismatch, match_master, match_slave;
+  logic resolved_q;
+  logic [NHARTS-1:0] faulty_q;
+
+  function automatic logic same_req(obi_req_t a, obi_req_t b);
+    return (a.req == b.req) && (a.addr == b.addr) && (a.we == b.we) && (a.be == b.be) &&
+           (!a.we || (a.wdata == b.wdata));
+  endfunction
+
+  function automatic logic is_ckpt(obi_req_t req);
+    return req.we && (req.addr == CKPT_ADDR);
+  endfunction
+
+  assign third = ~pair_i;
+
+  always_comb begin
+    third_req = '0;
+    third_gnt = 1'b0;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (third[i]) begin
+        third_req = core_data_req_i[i];
+        third_gnt = core_data_gnt_i[i];
+      end
+    end
+  end
+
+  //***Pair***//
+  //stale_q: after a tie-break the comparator flags stay up until the pair resumes
+  assign pair_acc = enable_i && (state_q == TB_IDLE) && pair_req_i[0].req && pair_gnt_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      pair_cnt_q  <= '0;
+      pair_ckpt_q <= 1'b0;
+      cap_q       <= 1'b0;
+      stale_q     <= 1'b0;
+      cap_valid_q <= 1'b0;
+      cap_cnt_q   <= '0;
+      cap_req_q   <= '0;
+    end else if (!enable_i) begin
+      pair_cnt_q  <= '0;
+      pair_ckpt_q <= 1'b0;
+      cap_q       <= 1'b0;
+      stale_q     <= 1'b0;
+      cap_valid_q <= 1'b0;
+    end else begin
+      if (pair_acc) begin
+        pair_cnt_q <= is_ckpt(pair_req_i[0]) ? '0 : pair_cnt_q + 32'd1;
+        if (is_ckpt(pair_req_i[0])) pair_ckpt_q <= 1'b1;
+        stale_q <= 1'b0;
+      end
+      if (state_q == TB_DONE && !start_i) begin
+        cap_q       <= 1'b0;
+        stale_q     <= 1'b1;
+        cap_valid_q <= 1'b0;
+      end else if (error_i && !cap_q && !stale_q && state_q == TB_IDLE) begin
+        cap_q       <= 1'b1;
+        cap_valid_q <= data_error_i && pair_ckpt_q;
+        cap_cnt_q   <= pair_cnt_q;
+        cap_req_q   <= pair_req_i;
+      end
+    end
+  end
+
+  //***Third hart***//
+  assign timeout = (timer_q == TIMEOUT);
+  assign at_mismatch = (state_q == TB_RUN) && run_ckpt_q && (run_cnt_q == cap_cnt_q);
+  assign match_master = same_req(third_req, cap_req_q[0]);
+  assign match_slave = same_req(third_req, cap_req_q[1]);
+
+  always_comb begin
+    state_d = state_q;
+    unique case (state_q)
+      TB_IDLE:    if (start_i) state_d = cap_valid_q ? TB_HALT : TB_DONE;
+      TB_HALT:    if (|(halt_ack_i & third)) state_d = TB_RESUME;
+                  else if (timeout) state_d = TB_ISOLATE;
+      TB_RESUME:  if (!(|(halt_ack_i & third))) state_d = TB_RUN;
+                  else if (timeout) state_d = TB_ISOLATE;
+      TB_RUN: begin
+        if (at_mismatch && third_req.req)
+          state_d = (match_master != match_slave) ? TB_LIVE : TB_ISOLATE;
+        else if (timeout || (|(sleep_i & third))) state_d = TB_ISOLATE;
+      end
+      TB_LIVE:    if (|(sleep_i & third)) state_d = TB_DONE;
+                  else if (timeout) state_d = TB_ISOLATE;
+      TB_ISOLATE: if (|(sleep_i & third)) state_d = TB_DONE;
+      TB_DONE:    if (!start_i) state_d = TB_IDLE;
+      default:    state_d = TB_IDLE;
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      state_q    <= TB_IDLE;
+      run_cnt_q  <= '0;
+      run_ckpt_q <= 1'b0;
+      timer_q    <= '0;
+      resolved_q <= 1'b0;
+      faulty_q   <= '0;
+    end else begin
+      state_q <= state_d;
+
+      if (state_q == TB_IDLE) timer_q <= '0;
+      else if (!timeout) timer_q <= timer_q + 32'd1;
+
+      if (state_q == TB_RESUME) begin
+        run_cnt_q  <= '0;
+        run_ckpt_q <= 1'b0;
+      end else if (state_q == TB_RUN && third_req.req && third_gnt) begin
+        run_cnt_q <= is_ckpt(third_req) ? '0 : run_cnt_q + 32'd1;
+        if (is_ckpt(third_req)) run_ckpt_q <= 1'b1;
+      end
+
+      if (state_q == TB_IDLE && start_i) begin
+        resolved_q <= 1'b0;
+        faulty_q   <= '0;
+      end else if (state_q == TB_RUN && state_d == TB_LIVE) begin
+        resolved_q <= 1'b1;
+        faulty_q   <= match_master ? (pair_i & ~master_i) : master_i;
+      end else if (state_d == TB_ISOLATE) begin
+        resolved_q <= 1'b0;
+        faulty_q   <= '0;
+      end
+    end
+  end
+
+  //Outputs
+  assign hart_o    = (state_q != TB_IDLE && state_q != TB_DONE) ? third : '0;
+  assign halt_o    = (state_q == TB_HALT) ? third : '0;
+  assign hold_o    = at_mismatch ? third : '0;
+  assign irq_o     = (state_q == TB_LIVE) ? third : '0;
+  assign isolate_o = (state_q == TB_ISOLATE) ? third : '0;
+  assign rec_o     = (state_q == TB_HALT) || (state_q == TB_RESUME);
+  assign done_o    = (state_q == TB_DONE);
+
+  assign live_o     = (state_q == TB_LIVE);
+  assign resolved_o = resolved_q;
+  assign faulty_o   = faulty_q;
+
+endmodule
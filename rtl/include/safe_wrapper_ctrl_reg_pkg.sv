@@ -7,7 +7,7 @@
 package safe_wrapper_ctrl_reg_pkg;
 
   // Address widths within the block
-  parameter int BlockAw = 6;
+  parameter int BlockAw = 8;
 
   ////////////////////////////
   // Typedefs for registers //
@@ -27,11 +27,58 @@ package safe_wrapper_ctrl_reg_pkg;
 
   typedef struct packed {logic q;} safe_wrapper_ctrl_reg2hw_end_sw_routine_reg_t;
 
+  typedef struct packed {logic [31:0] q;} safe_wrapper_ctrl_reg2hw_safe_copy_address_reg_t;
+
   typedef struct packed {
     struct packed {logic q;} enable_interrupt;
     struct packed {logic q;} status_interrupt;
   } safe_wrapper_ctrl_reg2hw_interrupt_controler_reg_t;
 
+  typedef struct packed {
+    struct packed {logic [7:0] q;} threshold;
+    struct packed {logic [23:0] q;} timeout;
+  } safe_wrapper_ctrl_reg2hw_intc_coalesce_reg_t;
+
+  typedef struct packed {logic [15:0] q;} safe_wrapper_ctrl_reg2hw_qos_priority_reg_t;
+
+  typedef struct packed {logic [31:0] q;} safe_wrapper_ctrl_reg2hw_qos_weight_reg_t;
+
+  typedef struct packed {logic [15:0] q;} safe_wrapper_ctrl_reg2hw_qos_bw_window_reg_t;
+
+  typedef struct packed {logic [31:0] q;} safe_wrapper_ctrl_reg2hw_qos_bw_cap0_reg_t;
+
+  typedef struct packed {logic [31:0] q;} safe_wrapper_ctrl_reg2hw_qos_bw_cap1_reg_t;
+
+  typedef struct packed {logic q;} safe_wrapper_ctrl_reg2hw_ecc_ctrl_reg_t;
+
+  typedef struct packed {
+    struct packed {logic q;} loose;
+    struct packed {logic [3:0] q;} delay;
+    struct packed {logic [23:0] q;} interval;
+  } safe_wrapper_ctrl_reg2hw_lockstep_ctrl_reg_t;
+
+  typedef struct packed {logic q;} safe_wrapper_ctrl_reg2hw_dmr_tiebreak_reg_t;
+
+  typedef struct packed {
+    logic q;
+    logic qe;
+  } safe_wrapper_ctrl_reg2hw_tel_clear_reg_t;
+
+  typedef struct packed {logic q;} safe_wrapper_ctrl_reg2hw_tmr_failover_reg_t;
+
+  typedef struct packed {logic q;} safe_wrapper_ctrl_reg2hw_sync_ctrl_reg_t;
+
+  typedef struct packed {
+    struct packed {logic q;} stores;
+    struct packed {logic q;} sample;
+    struct packed {logic [7:0] q;} nth;
+  } safe_wrapper_ctrl_reg2hw_check_policy_reg_t;
+
+  typedef struct packed {
+    logic [2:0] d;
+    logic       de;
+  } safe_wrapper_ctrl_hw2reg_master_core_reg_t;
+
   typedef struct packed {
     logic d;
     logic de;
@@ -74,44 +121,317 @@ package safe_wrapper_ctrl_reg_pkg;
     logic de;
   } safe_wrapper_ctrl_hw2reg_dmr_rec_reg_t;
 
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_cycle_count_reg_t;
+
+  typedef struct packed {
+    logic [7:0] d;
+    logic       de;
+  } safe_wrapper_ctrl_hw2reg_coalesced_jobs_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_ecc_corrected_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_ecc_uncorrected_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic d;
+      logic de;
+    } live;
+    struct packed {
+      logic d;
+      logic de;
+    } resolved;
+    struct packed {
+      logic [2:0] d;
+      logic       de;
+    } faulty;
+  } safe_wrapper_ctrl_hw2reg_dmr_tiebreak_status_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart0;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart1;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart2;
+  } safe_wrapper_ctrl_hw2reg_tel_cnt_req_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart0;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart1;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart2;
+  } safe_wrapper_ctrl_hw2reg_tel_cnt_addr_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart0;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart1;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart2;
+  } safe_wrapper_ctrl_hw2reg_tel_cnt_we_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart0;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart1;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart2;
+  } safe_wrapper_ctrl_hw2reg_tel_cnt_be_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart0;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart1;
+    struct packed {
+      logic [9:0] d;
+      logic       de;
+    } hart2;
+  } safe_wrapper_ctrl_hw2reg_tel_cnt_wdata_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [1:0] d;
+      logic       de;
+    } next;
+    struct packed {
+      logic [3:0] d;
+      logic       de;
+    } valid;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_status_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } entry0;
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } entry1;
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } entry2;
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } entry3;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_info_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_addr0_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_addr1_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_addr2_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_addr3_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_time0_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_time1_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_time2_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_tel_ring_time3_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } count;
+    struct packed {
+      logic [2:0] d;
+      logic       de;
+    } faulty;
+  } safe_wrapper_ctrl_hw2reg_tmr_failover_status_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } safe_wrapper_ctrl_hw2reg_sync_latency_reg_t;
+
   // Register -> HW type
   typedef struct packed {
-    safe_wrapper_ctrl_reg2hw_safe_configuration_reg_t safe_configuration;  // [13:12]
-    safe_wrapper_ctrl_reg2hw_dmr_mask_reg_t dmr_mask;  // [11:9]
-    safe_wrapper_ctrl_reg2hw_master_core_reg_t master_core;  // [8:6]
-    safe_wrapper_ctrl_reg2hw_critical_section_reg_t critical_section;  // [5:5]
-    safe_wrapper_ctrl_reg2hw_start_reg_t start;  // [4:4]
-    safe_wrapper_ctrl_reg2hw_initial_sync_master_reg_t initial_sync_master;  // [3:3]
-    safe_wrapper_ctrl_reg2hw_end_sw_routine_reg_t end_sw_routine;  // [2:2]
-    safe_wrapper_ctrl_reg2hw_interrupt_controler_reg_t interrupt_controler;  // [1:0]
+    safe_wrapper_ctrl_reg2hw_safe_configuration_reg_t safe_configuration;  // [250:249]
+    safe_wrapper_ctrl_reg2hw_dmr_mask_reg_t dmr_mask;  // [248:246]
+    safe_wrapper_ctrl_reg2hw_master_core_reg_t master_core;  // [245:243]
+    safe_wrapper_ctrl_reg2hw_critical_section_reg_t critical_section;  // [242:242]
+    safe_wrapper_ctrl_reg2hw_start_reg_t start;  // [241:241]
+    safe_wrapper_ctrl_reg2hw_initial_sync_master_reg_t initial_sync_master;  // [240:240]
+    safe_wrapper_ctrl_reg2hw_end_sw_routine_reg_t end_sw_routine;  // [239:239]
+    safe_wrapper_ctrl_reg2hw_safe_copy_address_reg_t safe_copy_address;  // [238:207]
+    safe_wrapper_ctrl_reg2hw_interrupt_controler_reg_t interrupt_controler;  // [206:205]
+    safe_wrapper_ctrl_reg2hw_intc_coalesce_reg_t intc_coalesce;  // [204:173]
+    safe_wrapper_ctrl_reg2hw_qos_priority_reg_t qos_priority;  // [172:157]
+    safe_wrapper_ctrl_reg2hw_qos_weight_reg_t qos_weight;  // [156:125]
+    safe_wrapper_ctrl_reg2hw_qos_bw_window_reg_t qos_bw_window;  // [124:109]
+    safe_wrapper_ctrl_reg2hw_qos_bw_cap0_reg_t qos_bw_cap0;  // [108:77]
+    safe_wrapper_ctrl_reg2hw_qos_bw_cap1_reg_t qos_bw_cap1;  // [76:45]
+    safe_wrapper_ctrl_reg2hw_ecc_ctrl_reg_t ecc_ctrl;  // [44:44]
+    safe_wrapper_ctrl_reg2hw_lockstep_ctrl_reg_t lockstep_ctrl;  // [43:15]
+    safe_wrapper_ctrl_reg2hw_dmr_tiebreak_reg_t dmr_tiebreak;  // [14:14]
+    safe_wrapper_ctrl_reg2hw_tel_clear_reg_t tel_clear;  // [13:12]
+    safe_wrapper_ctrl_reg2hw_tmr_failover_reg_t tmr_failover;  // [11:11]
+    safe_wrapper_ctrl_reg2hw_sync_ctrl_reg_t sync_ctrl;  // [10:10]
+    safe_wrapper_ctrl_reg2hw_check_policy_reg_t check_policy;  // [9:0]
   } safe_wrapper_ctrl_reg2hw_t;
 
   // HW -> register type
   typedef struct packed {
-    safe_wrapper_ctrl_hw2reg_start_reg_t start;  // [20:19]
-    safe_wrapper_ctrl_hw2reg_external_debug_req_reg_t external_debug_req;  // [18:16]
-    safe_wrapper_ctrl_hw2reg_end_sw_routine_reg_t end_sw_routine;  // [15:14]
-    safe_wrapper_ctrl_hw2reg_interrupt_controler_reg_t interrupt_controler;  // [13:10]
-    safe_wrapper_ctrl_hw2reg_cb_heep_status_reg_t cb_heep_status;  // [9:2]
-    safe_wrapper_ctrl_hw2reg_dmr_rec_reg_t dmr_rec;  // [1:0]
+    safe_wrapper_ctrl_hw2reg_master_core_reg_t master_core;  // [659:656]
+    safe_wrapper_ctrl_hw2reg_start_reg_t start;  // [655:654]
+    safe_wrapper_ctrl_hw2reg_external_debug_req_reg_t external_debug_req;  // [653:651]
+    safe_wrapper_ctrl_hw2reg_end_sw_routine_reg_t end_sw_routine;  // [650:649]
+    safe_wrapper_ctrl_hw2reg_interrupt_controler_reg_t interrupt_controler;  // [648:645]
+    safe_wrapper_ctrl_hw2reg_cb_heep_status_reg_t cb_heep_status;  // [644:637]
+    safe_wrapper_ctrl_hw2reg_dmr_rec_reg_t dmr_rec;  // [636:635]
+    safe_wrapper_ctrl_hw2reg_cycle_count_reg_t cycle_count;  // [634:602]
+    safe_wrapper_ctrl_hw2reg_coalesced_jobs_reg_t coalesced_jobs;  // [601:593]
+    safe_wrapper_ctrl_hw2reg_ecc_corrected_reg_t ecc_corrected;  // [592:560]
+    safe_wrapper_ctrl_hw2reg_ecc_uncorrected_reg_t ecc_uncorrected;  // [559:527]
+    safe_wrapper_ctrl_hw2reg_dmr_tiebreak_status_reg_t dmr_tiebreak_status;  // [526:519]
+    safe_wrapper_ctrl_hw2reg_tel_cnt_req_reg_t tel_cnt_req;  // [518:486]
+    safe_wrapper_ctrl_hw2reg_tel_cnt_addr_reg_t tel_cnt_addr;  // [485:453]
+    safe_wrapper_ctrl_hw2reg_tel_cnt_we_reg_t tel_cnt_we;  // [452:420]
+    safe_wrapper_ctrl_hw2reg_tel_cnt_be_reg_t tel_cnt_be;  // [419:387]
+    safe_wrapper_ctrl_hw2reg_tel_cnt_wdata_reg_t tel_cnt_wdata;  // [386:354]
+    safe_wrapper_ctrl_hw2reg_tel_ring_status_reg_t tel_ring_status;  // [353:346]
+    safe_wrapper_ctrl_hw2reg_tel_ring_info_reg_t tel_ring_info;  // [345:310]
+    safe_wrapper_ctrl_hw2reg_tel_ring_addr0_reg_t tel_ring_addr0;  // [309:277]
+    safe_wrapper_ctrl_hw2reg_tel_ring_addr1_reg_t tel_ring_addr1;  // [276:244]
+    safe_wrapper_ctrl_hw2reg_tel_ring_addr2_reg_t tel_ring_addr2;  // [243:211]
+    safe_wrapper_ctrl_hw2reg_tel_ring_addr3_reg_t tel_ring_addr3;  // [210:178]
+    safe_wrapper_ctrl_hw2reg_tel_ring_time0_reg_t tel_ring_time0;  // [177:145]
+    safe_wrapper_ctrl_hw2reg_tel_ring_time1_reg_t tel_ring_time1;  // [144:112]
+    safe_wrapper_ctrl_hw2reg_tel_ring_time2_reg_t tel_ring_time2;  // [111:79]
+    safe_wrapper_ctrl_hw2reg_tel_ring_time3_reg_t tel_ring_time3;  // [78:46]
+    safe_wrapper_ctrl_hw2reg_tmr_failover_status_reg_t tmr_failover_status;  // [45:33]
+    safe_wrapper_ctrl_hw2reg_sync_latency_reg_t sync_latency;  // [32:0]
   } safe_wrapper_ctrl_hw2reg_t;
 
   // Register offsets
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SAFE_CONFIGURATION_OFFSET = 6'h0;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_MASK_OFFSET = 6'h4;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_MASTER_CORE_OFFSET = 6'h8;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CRITICAL_SECTION_OFFSET = 6'hc;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_START_OFFSET = 6'h10;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_BOOT_ADDRESS_OFFSET = 6'h14;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_EXTERNAL_DEBUG_REQ_OFFSET = 6'h18;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INITIAL_SYNC_MASTER_OFFSET = 6'h1c;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_END_SW_ROUTINE_OFFSET = 6'h20;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_ENTRY_ADDRESS_OFFSET = 6'h24;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SAFE_COPY_ADDRESS_OFFSET = 6'h28;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER_OFFSET = 6'h2c;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CB_HEEP_STATUS_OFFSET = 6'h30;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_REC_OFFSET = 6'h34;
-  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR_OFFSET = 6'h38;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SAFE_CONFIGURATION_OFFSET = 8'h0;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_MASK_OFFSET = 8'h4;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_MASTER_CORE_OFFSET = 8'h8;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CRITICAL_SECTION_OFFSET = 8'hc;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_START_OFFSET = 8'h10;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_BOOT_ADDRESS_OFFSET = 8'h14;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_EXTERNAL_DEBUG_REQ_OFFSET = 8'h18;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INITIAL_SYNC_MASTER_OFFSET = 8'h1c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_END_SW_ROUTINE_OFFSET = 8'h20;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_ENTRY_ADDRESS_OFFSET = 8'h24;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SAFE_COPY_ADDRESS_OFFSET = 8'h28;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER_OFFSET = 8'h2c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CB_HEEP_STATUS_OFFSET = 8'h30;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_REC_OFFSET = 8'h34;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR_OFFSET = 8'h38;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_EXIT_STATUS_OFFSET = 8'h3c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CYCLE_COUNT_OFFSET = 8'h40;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_INTC_COALESCE_OFFSET = 8'h44;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_COALESCED_JOBS_OFFSET = 8'h48;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_WARM_BOOT_OFFSET = 8'h4c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_WARM_ENTRY_OFFSET = 8'h50;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_WARM_CHECKSUM_OFFSET = 8'h54;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_QOS_PRIORITY_OFFSET = 8'h58;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_QOS_WEIGHT_OFFSET = 8'h5c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_OFFSET = 8'h60;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_QOS_BW_CAP0_OFFSET = 8'h64;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_QOS_BW_CAP1_OFFSET = 8'h68;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_ECC_CTRL_OFFSET = 8'h6c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_ECC_CORRECTED_OFFSET = 8'h70;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_ECC_UNCORRECTED_OFFSET = 8'h74;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_OFFSET = 8'h78;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_TIEBREAK_OFFSET = 8'h7c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_OFFSET = 8'h80;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_OFFSET = 8'h84;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CNT_REQ_OFFSET = 8'h88;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_OFFSET = 8'h8c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CNT_WE_OFFSET = 8'h90;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CNT_BE_OFFSET = 8'h94;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_OFFSET = 8'h98;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_STATUS_OFFSET = 8'h9c;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_INFO_OFFSET = 8'ha0;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_ADDR0_OFFSET = 8'ha4;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_ADDR1_OFFSET = 8'ha8;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_ADDR2_OFFSET = 8'hac;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_ADDR3_OFFSET = 8'hb0;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_TIME0_OFFSET = 8'hb4;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_TIME1_OFFSET = 8'hb8;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_TIME2_OFFSET = 8'hbc;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_RING_TIME3_OFFSET = 8'hc0;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TEL_CLEAR_OFFSET = 8'hc4;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TMR_FAILOVER_OFFSET = 8'hc8;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_OFFSET = 8'hcc;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SYNC_CTRL_OFFSET = 8'hd0;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_SYNC_LATENCY_OFFSET = 8'hd4;
+  parameter logic [BlockAw-1:0] SAFE_WRAPPER_CTRL_CHECK_POLICY_OFFSET = 8'hd8;
 
   // Register index
   typedef enum int {
@@ -129,11 +449,51 @@ package safe_wrapper_ctrl_reg_pkg;
     SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER,
     SAFE_WRAPPER_CTRL_CB_HEEP_STATUS,
     SAFE_WRAPPER_CTRL_DMR_REC,
-    SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR
+    SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR,
+    SAFE_WRAPPER_CTRL_EXIT_STATUS,
+    SAFE_WRAPPER_CTRL_CYCLE_COUNT,
+    SAFE_WRAPPER_CTRL_INTC_COALESCE,
+    SAFE_WRAPPER_CTRL_COALESCED_JOBS,
+    SAFE_WRAPPER_CTRL_WARM_BOOT,
+    SAFE_WRAPPER_CTRL_WARM_ENTRY,
+    SAFE_WRAPPER_CTRL_WARM_CHECKSUM,
+    SAFE_WRAPPER_CTRL_QOS_PRIORITY,
+    SAFE_WRAPPER_CTRL_QOS_WEIGHT,
+    SAFE_WRAPPER_CTRL_QOS_BW_WINDOW,
+    SAFE_WRAPPER_CTRL_QOS_BW_CAP0,
+    SAFE_WRAPPER_CTRL_QOS_BW_CAP1,
+    SAFE_WRAPPER_CTRL_ECC_CTRL,
+    SAFE_WRAPPER_CTRL_ECC_CORRECTED,
+    SAFE_WRAPPER_CTRL_ECC_UNCORRECTED,
+    SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL,
+    SAFE_WRAPPER_CTRL_DMR_TIEBREAK,
+    SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS,
+    SAFE_WRAPPER_CTRL_DMR_CHECKPOINT,
+    SAFE_WRAPPER_CTRL_TEL_CNT_REQ,
+    SAFE_WRAPPER_CTRL_TEL_CNT_ADDR,
+    SAFE_WRAPPER_CTRL_TEL_CNT_WE,
+    SAFE_WRAPPER_CTRL_TEL_CNT_BE,
+    SAFE_WRAPPER_CTRL_TEL_CNT_WDATA,
+    SAFE_WRAPPER_CTRL_TEL_RING_STATUS,
+    SAFE_WRAPPER_CTRL_TEL_RING_INFO,
+    SAFE_WRAPPER_CTRL_TEL_RING_ADDR0,
+    SAFE_WRAPPER_CTRL_TEL_RING_ADDR1,
+    SAFE_WRAPPER_CTRL_TEL_RING_ADDR2,
+    SAFE_WRAPPER_CTRL_TEL_RING_ADDR3,
+    SAFE_WRAPPER_CTRL_TEL_RING_TIME0,
+    SAFE_WRAPPER_CTRL_TEL_RING_TIME1,
+    SAFE_WRAPPER_CTRL_TEL_RING_TIME2,
+    SAFE_WRAPPER_CTRL_TEL_RING_TIME3,
+    SAFE_WRAPPER_CTRL_TEL_CLEAR,
+    SAFE_WRAPPER_CTRL_TMR_FAILOVER,
+    SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS,
+    SAFE_WRAPPER_CTRL_SYNC_CTRL,
+    SAFE_WRAPPER_CTRL_SYNC_LATENCY,
+    SAFE_WRAPPER_CTRL_CHECK_POLICY
   } safe_wrapper_ctrl_id_e;
 
   // Register width information to check illegal writes
-  parameter logic [3:0] SAFE_WRAPPER_CTRL_PERMIT[15] = '{
+  parameter logic [3:0] SAFE_WRAPPER_CTRL_PERMIT[55] = '{
       4'b0001,  // index[ 0] SAFE_WRAPPER_CTRL_SAFE_CONFIGURATION
       4'b0001,  // index[ 1] SAFE_WRAPPER_CTRL_DMR_MASK
       4'b0001,  // index[ 2] SAFE_WRAPPER_CTRL_MASTER_CORE
@@ -148,7 +508,47 @@ package safe_wrapper_ctrl_reg_pkg;
       4'b0001,  // index[11] SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER
       4'b0001,  // index[12] SAFE_WRAPPER_CTRL_CB_HEEP_STATUS
       4'b0001,  // index[13] SAFE_WRAPPER_CTRL_DMR_REC
-      4'b1111  // index[14] SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR
+      4'b1111,  // index[14] SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR
+      4'b1111,  // index[15] SAFE_WRAPPER_CTRL_EXIT_STATUS
+      4'b1111,  // index[16] SAFE_WRAPPER_CTRL_CYCLE_COUNT
+      4'b1111,  // index[17] SAFE_WRAPPER_CTRL_INTC_COALESCE
+      4'b0001,  // index[18] SAFE_WRAPPER_CTRL_COALESCED_JOBS
+      4'b0001,  // index[19] SAFE_WRAPPER_CTRL_WARM_BOOT
+      4'b1111,  // index[20] SAFE_WRAPPER_CTRL_WARM_ENTRY
+      4'b1111,  // index[21] SAFE_WRAPPER_CTRL_WARM_CHECKSUM
+      4'b0011,  // index[22] SAFE_WRAPPER_CTRL_QOS_PRIORITY
+      4'b1111,  // index[23] SAFE_WRAPPER_CTRL_QOS_WEIGHT
+      4'b0011,  // index[24] SAFE_WRAPPER_CTRL_QOS_BW_WINDOW
+      4'b1111,  // index[25] SAFE_WRAPPER_CTRL_QOS_BW_CAP0
+      4'b1111,  // index[26] SAFE_WRAPPER_CTRL_QOS_BW_CAP1
+      4'b0001,  // index[27] SAFE_WRAPPER_CTRL_ECC_CTRL
+      4'b1111,  // index[28] SAFE_WRAPPER_CTRL_ECC_CORRECTED
+      4'b1111,  // index[29] SAFE_WRAPPER_CTRL_ECC_UNCORRECTED
+      4'b1111,  // index[30] SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL
+      4'b0001,  // index[31] SAFE_WRAPPER_CTRL_DMR_TIEBREAK
+      4'b0001,  // index[32] SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS
+      4'b0001,  // index[33] SAFE_WRAPPER_CTRL_DMR_CHECKPOINT
+      4'b1111,  // index[34] SAFE_WRAPPER_CTRL_TEL_CNT_REQ
+      4'b1111,  // index[35] SAFE_WRAPPER_CTRL_TEL_CNT_ADDR
+      4'b1111,  // index[36] SAFE_WRAPPER_CTRL_TEL_CNT_WE
+      4'b1111,  // index[37] SAFE_WRAPPER_CTRL_TEL_CNT_BE
+      4'b1111,  // index[38] SAFE_WRAPPER_CTRL_TEL_CNT_WDATA
+      4'b0001,  // index[39] SAFE_WRAPPER_CTRL_TEL_RING_STATUS
+      4'b1111,  // index[40] SAFE_WRAPPER_CTRL_TEL_RING_INFO
+      4'b1111,  // index[41] SAFE_WRAPPER_CTRL_TEL_RING_ADDR0
+      4'b1111,  // index[42] SAFE_WRAPPER_CTRL_TEL_RING_ADDR1
+      4'b1111,  // index[43] SAFE_WRAPPER_CTRL_TEL_RING_ADDR2
+      4'b1111,  // index[44] SAFE_WRAPPER_CTRL_TEL_RING_ADDR3
+      4'b1111,  // index[45] SAFE_WRAPPER_CTRL_TEL_RING_TIME0
+      4'b1111,  // index[46] SAFE_WRAPPER_CTRL_TEL_RING_TIME1
+      4'b1111,  // index[47] SAFE_WRAPPER_CTRL_TEL_RING_TIME2
+      4'b1111,  // index[48] SAFE_WRAPPER_CTRL_TEL_RING_TIME3
+      4'b0001,  // index[49] SAFE_WRAPPER_CTRL_TEL_CLEAR
+      4'b0001,  // index[50] SAFE_WRAPPER_CTRL_TMR_FAILOVER
+      4'b0011,  // index[51] SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS
+      4'b0001,  // index[52] SAFE_WRAPPER_CTRL_SYNC_CTRL
+      4'b1111,  // index[53] SAFE_WRAPPER_CTRL_SYNC_LATENCY
+      4'b0011  // index[54] SAFE_WRAPPER_CTRL_CHECK_POLICY
   };
 
 endpackage
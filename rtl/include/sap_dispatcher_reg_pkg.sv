@@ -0,0 +1,90 @@
+// Copyright lowRISC contributors.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Register Package auto-generated by `reggen` containing data structure
+
+package sap_dispatcher_reg_pkg;
+
+  // Address widths within the block
+  parameter int BlockAw = 5;
+
+  ////////////////////////////
+  // Typedefs for registers //
+  ////////////////////////////
+
+  typedef struct packed {
+    struct packed {logic q;} enable;
+    struct packed {logic [7:0] q;} cluster_mask;
+  } sap_dispatcher_reg2hw_ctrl_reg_t;
+
+  typedef struct packed {
+    logic [31:0] q;
+    logic        qe;
+  } sap_dispatcher_reg2hw_job_submit_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic d;
+      logic de;
+    } queue_full;
+    struct packed {
+      logic d;
+      logic de;
+    } queue_empty;
+    struct packed {
+      logic [7:0] d;
+      logic       de;
+    } clusters_idle;
+  } sap_dispatcher_hw2reg_status_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } sap_dispatcher_hw2reg_jobs_dispatched_reg_t;
+
+  typedef struct packed {
+    logic [31:0] d;
+    logic        de;
+  } sap_dispatcher_hw2reg_jobs_done_reg_t;
+
+  // Register -> HW type
+  typedef struct packed {
+    sap_dispatcher_reg2hw_ctrl_reg_t ctrl;  // [41:33]
+    sap_dispatcher_reg2hw_job_submit_reg_t job_submit;  // [32:0]
+  } sap_dispatcher_reg2hw_t;
+
+  // HW -> register type
+  typedef struct packed {
+    sap_dispatcher_hw2reg_status_reg_t status;  // [78:66]
+    sap_dispatcher_hw2reg_jobs_dispatched_reg_t jobs_dispatched;  // [65:33]
+    sap_dispatcher_hw2reg_jobs_done_reg_t jobs_done;  // [32:0]
+  } sap_dispatcher_hw2reg_t;
+
+  // Register offsets
+  parameter logic [BlockAw-1:0] SAP_DISPATCHER_CTRL_OFFSET = 5'h0;
+  parameter logic [BlockAw-1:0] SAP_DISPATCHER_JOB_SUBMIT_OFFSET = 5'h4;
+  parameter logic [BlockAw-1:0] SAP_DISPATCHER_STATUS_OFFSET = 5'h8;
+  parameter logic [BlockAw-1:0] SAP_DISPATCHER_JOBS_DISPATCHED_OFFSET = 5'hc;
+  parameter logic [BlockAw-1:0] SAP_DISPATCHER_JOBS_DONE_OFFSET = 5'h10;
+
+  // Register index
+  typedef enum int {
+    SAP_DISPATCHER_CTRL,
+    SAP_DISPATCHER_JOB_SUBMIT,
+    SAP_DISPATCHER_STATUS,
+    SAP_DISPATCHER_JOBS_DISPATCHED,
+    SAP_DISPATCHER_JOBS_DONE
+  } sap_dispatcher_id_e;
+
+  // Register width information to check illegal writes
+  parameter logic [3:0] SAP_DISPATCHER_PERMIT[5] = '{
+      4'b0011,  // index[0] SAP_DISPATCHER_CTRL
+      4'b1111,  // index[1] SAP_DISPATCHER_JOB_SUBMIT
+      4'b0011,  // index[2] SAP_DISPATCHER_STATUS
+      4'b1111,  // index[3] SAP_DISPATCHER_JOBS_DISPATCHED
+      4'b1111  // index[4] SAP_DISPATCHER_JOBS_DONE
+  };
+
+endpackage
+
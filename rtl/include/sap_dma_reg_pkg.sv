@@ -0,0 +1,114 @@
+// Copyright lowRISC contributors.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Register Package auto-generated by `reggen` containing data structure
+
+package sap_dma_reg_pkg;
+
+  // Address widths within the block
+  parameter int BlockAw = 6;
+
+  ////////////////////////////
+  // Typedefs for registers //
+  ////////////////////////////
+
+  typedef struct packed {logic [31:0] q;} sap_dma_reg2hw_src_addr_reg_t;
+
+  typedef struct packed {logic [31:0] q;} sap_dma_reg2hw_dst_addr_reg_t;
+
+  typedef struct packed {logic [15:0] q;} sap_dma_reg2hw_d1_len_reg_t;
+
+  typedef struct packed {logic [15:0] q;} sap_dma_reg2hw_d2_len_reg_t;
+
+  typedef struct packed {logic [31:0] q;} sap_dma_reg2hw_src_stride_reg_t;
+
+  typedef struct packed {logic [31:0] q;} sap_dma_reg2hw_dst_stride_reg_t;
+
+  typedef struct packed {logic [31:0] q;} sap_dma_reg2hw_next_desc_reg_t;
+
+  typedef struct packed {
+    struct packed {logic q;} start;
+    struct packed {logic q;} irq_en;
+  } sap_dma_reg2hw_ctrl_reg_t;
+
+  typedef struct packed {
+    struct packed {logic q;} done;
+  } sap_dma_reg2hw_status_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic d;
+      logic de;
+    } start;
+  } sap_dma_hw2reg_ctrl_reg_t;
+
+  typedef struct packed {
+    struct packed {
+      logic d;
+      logic de;
+    } busy;
+    struct packed {
+      logic d;
+      logic de;
+    } done;
+  } sap_dma_hw2reg_status_reg_t;
+
+  // Register -> HW type
+  typedef struct packed {
+    sap_dma_reg2hw_src_addr_reg_t src_addr;  // [194:163]
+    sap_dma_reg2hw_dst_addr_reg_t dst_addr;  // [162:131]
+    sap_dma_reg2hw_d1_len_reg_t d1_len;  // [130:115]
+    sap_dma_reg2hw_d2_len_reg_t d2_len;  // [114:99]
+    sap_dma_reg2hw_src_stride_reg_t src_stride;  // [98:67]
+    sap_dma_reg2hw_dst_stride_reg_t dst_stride;  // [66:35]
+    sap_dma_reg2hw_next_desc_reg_t next_desc;  // [34:3]
+    sap_dma_reg2hw_ctrl_reg_t ctrl;  // [2:1]
+    sap_dma_reg2hw_status_reg_t status;  // [0:0]
+  } sap_dma_reg2hw_t;
+
+  // HW -> register type
+  typedef struct packed {
+    sap_dma_hw2reg_ctrl_reg_t ctrl;  // [5:4]
+    sap_dma_hw2reg_status_reg_t status;  // [3:0]
+  } sap_dma_hw2reg_t;
+
+  // Register offsets
+  parameter logic [BlockAw-1:0] SAP_DMA_SRC_ADDR_OFFSET = 6'h0;
+  parameter logic [BlockAw-1:0] SAP_DMA_DST_ADDR_OFFSET = 6'h4;
+  parameter logic [BlockAw-1:0] SAP_DMA_D1_LEN_OFFSET = 6'h8;
+  parameter logic [BlockAw-1:0] SAP_DMA_D2_LEN_OFFSET = 6'hc;
+  parameter logic [BlockAw-1:0] SAP_DMA_SRC_STRIDE_OFFSET = 6'h10;
+  parameter logic [BlockAw-1:0] SAP_DMA_DST_STRIDE_OFFSET = 6'h14;
+  parameter logic [BlockAw-1:0] SAP_DMA_NEXT_DESC_OFFSET = 6'h18;
+  parameter logic [BlockAw-1:0] SAP_DMA_CTRL_OFFSET = 6'h1c;
+  parameter logic [BlockAw-1:0] SAP_DMA_STATUS_OFFSET = 6'h20;
+
+  // Register index
+  typedef enum int {
+    SAP_DMA_SRC_ADDR,
+    SAP_DMA_DST_ADDR,
+    SAP_DMA_D1_LEN,
+    SAP_DMA_D2_LEN,
+    SAP_DMA_SRC_STRIDE,
+    SAP_DMA_DST_STRIDE,
+    SAP_DMA_NEXT_DESC,
+    SAP_DMA_CTRL,
+    SAP_DMA_STATUS
+  } sap_dma_id_e;
+
+  // Register width information to check illegal writes
+  parameter logic [3:0] SAP_DMA_PERMIT[9] = '{
+      4'b1111,  // index[0] SAP_DMA_SRC_ADDR
+      4'b1111,  // index[1] SAP_DMA_DST_ADDR
+      4'b0011,  // index[2] SAP_DMA_D1_LEN
+      4'b0011,  // index[3] SAP_DMA_D2_LEN
+      4'b1111,  // index[4] SAP_DMA_SRC_STRIDE
+      4'b1111,  // index[5] SAP_DMA_DST_STRIDE
+      4'b1111,  // index[6] SAP_DMA_NEXT_DESC
+      4'b0001,  // index[7] SAP_DMA_CTRL
+      4'b0001  // index[8] SAP_DMA_STATUS
+  };
+
+endpackage
+
@@ -30,35 +30,98 @@ package sap_pkg;
   } cpu_type_e;
 
   localparam cpu_type_e CPU_type = CV32E20;
-  localparam NCYCLES = 1;
+  localparam NCYCLES = 4;  //Maximum lockstep delay, the delay in use is Lockstep_Ctrl.DELAY
+
+  //Harts: independent redundancy groups of HARTS_PER_GROUP harts, each with its
+  //own safe_FSM and safe_wrapper_ctrl block (SAFE_CPU_REGISTER_SIZE apart, all of
+  //them inside the CSR window of the cluster). The group datapath is written for
+  //a triple: HARTS_PER_GROUP is fixed, scale the harts with NGROUPS.
+  localparam int unsigned HARTS_PER_GROUP = 3;  //fixed
+  localparam int unsigned NGROUPS = 1;
+  localparam int unsigned NHARTS = NGROUPS * HARTS_PER_GROUP;
 
   //System Bus
   typedef enum logic {
-    NtoM
-    //  onetoM //Not implemented
+    NtoM,  //Crossbar, one arbiter per slave
+    onetoM  //Shared bus, one arbiter for all the slaves (lowest area)
   } bus_type_e;
 
-  localparam bus_type_e BusType = NtoM;
+  localparam bus_type_e BusType = bus_type_e'(0);
+  //In-order transactions in flight per master/slave port of the system xbar
+  localparam int unsigned XBAR_MAX_OUTSTANDING = 4;
+
+  //Memory Banks
+  typedef enum logic [1:0] {
+    CONTIGUOUS,  //Bank i holds [i*MEM_SIZE/NUM_BANKS, (i+1)*MEM_SIZE/NUM_BANKS)
+    WORD_INTERLEAVED,  //Consecutive words rotate across the banks
+    LINE_INTERLEAVED  //Consecutive lines of MEM_LINE_WORDS rotate across the banks
+  } mem_layout_e;
+
+  localparam mem_layout_e MemLayout = mem_layout_e'(0);
+  localparam int unsigned MEM_LINE_WORDS = 32'h4;
+
+  //master idx: instr/data of hart i at 2*i / 2*i+1, then external and DMA
+  function automatic logic [31:0] core_instr_idx(int unsigned hart);
+    return 32'(2 * hart);
+  endfunction
+
+  function automatic logic [31:0] core_data_idx(int unsigned hart);
+    return 32'(2 * hart + 1);
+  endfunction
+
+  localparam logic [31:0] EXTERNAL_MASTER_IDX = 2 * NHARTS;
+  localparam logic [31:0] DMA_MASTER_IDX = 2 * NHARTS + 1;
+
+  localparam SYSTEM_XBAR_NMASTER = 2 * NHARTS + 2;
+  localparam int unsigned NUM_BANKS = 32'h2;  //power of 2 when interleaved
+  localparam int unsigned MEM_BANK_SIZE = 32'h8000;
+  localparam int unsigned MEM_SIZE = NUM_BANKS * MEM_BANK_SIZE;
+
+  //Dual port banks: port B of bank i is slave MEMORY_RAM0_IDX + NUM_BANKS + i
+  localparam int unsigned MEM_PORTS = 1;  //1 or 2
+  //Masters routed to port B (instruction fetch), the rest use port A
+  function automatic logic [SYSTEM_XBAR_NMASTER-1:0] gen_mem_portb_masters();
+    logic [SYSTEM_XBAR_NMASTER-1:0] masters = '0;
+    for (int unsigned i = 0; i < NHARTS; i++) masters[core_instr_idx(i)] = 1'b1;
+    return masters;
+  endfunction
+
+  localparam logic [SYSTEM_XBAR_NMASTER-1:0] MEM_PORTB_MASTERS = gen_mem_portb_masters();
+
+  //SECDED RAM banks (sap_mem_ecc): single port, scrubber and counters in Ecc_* CSRs
+  localparam bit MEM_ECC = 1'b0;
+
+  //Instruction line buffer with next-line prefetch per core port (sap_ibuf)
+  localparam bit IBUF_ENABLE = 1'b0;
+  localparam int unsigned IBUF_LINE_WORDS = 4;  //power of 2
+
+  //Register stage after the TMR voter / DMR comparator (+1 cycle request latency)
+  localparam bit VOTER_PIPELINE = 1'b0;
 
-  //master idx
-  localparam logic [31:0] CORE0_INSTR_IDX = 0;
-  localparam logic [31:0] CORE0_DATA_IDX = 1;
-  localparam logic [31:0] CORE1_INSTR_IDX = 2;
-  localparam logic [31:0] CORE1_DATA_IDX = 3;
-  localparam logic [31:0] CORE2_INSTR_IDX = 4;
-  localparam logic [31:0] CORE2_DATA_IDX = 5;
-  localparam logic [31:0] EXTERNAL_MASTER_IDX = 6;
+  //Loose lockstep (Lockstep_Ctrl.LOOSE): replayed data responses of the trailing core
+  localparam int unsigned LOCKSTEP_FIFO_DEPTH = 8;
 
-  localparam SYSTEM_XBAR_NMASTER = 7;
-  localparam SYSTEM_XBAR_NSLAVE = 5; /*1 ERROR / 2 INTERNAL_PERIPH / 3 EXTERNAL_PERIPH* / 4 RAM0 / 5 RAM1 */
+  //External interrupts latched and delivered at a fetch boundary of the group (irq_sync)
+  localparam bit IRQ_SYNC = 1'b0;
+
+  //DCLS tie-break (Dmr_Tiebreak.EN): cycles given to the third hart to reach the mismatch
+  localparam int unsigned DMR_TIEBREAK_TIMEOUT = 32'h0010_0000;
+
+  localparam SYSTEM_XBAR_NRULES = 3 + NUM_BANKS;
+  localparam SYSTEM_XBAR_NSLAVE = 3 + NUM_BANKS * MEM_PORTS; /*1 ERROR / 2 INTERNAL_PERIPH / 3 EXTERNAL_PERIPH* / 4.. RAM BANKS (port A, port B) */
+
+  //System xbar QoS, programmed through the safe_wrapper_ctrl Qos_* registers
+  typedef struct packed {
+    logic [SYSTEM_XBAR_NMASTER-1:0][1:0] prio;
+    logic [SYSTEM_XBAR_NMASTER-1:0][3:0] weight;
+    logic [15:0]                         bw_window;
+    logic [SYSTEM_XBAR_NMASTER-1:0][7:0] bw_cap;
+  } xbar_qos_t;
 
   localparam GLOBAL_BASE_ADDRESS = 32'h19000000;
   localparam SAFE_CSR_BASE_ADDRESS = 32'h20000000; /*core_v_mini_mcu_pkg::EXT_PERIPHERAL_START_ADDRESS;*/
 
 
-  localparam int unsigned MEM_SIZE = 32'h00010000;
-  localparam int unsigned NUM_BANKS = 2;
-
 
   // Internal BUS-REGISTER slave address map
   // ---------------------------------------
@@ -72,6 +135,7 @@ package sap_pkg;
   // corresponding external master port.
   localparam logic [31:0] DEMUX_INT_XBAR_IDX = 32'd0;
   localparam logic [31:0] DEMUX_SAFE_CPU_REGISTER_IDX = 32'd1;
+  localparam logic [31:0] DEMUX_TCM_IDX = 32'd2;
 
   // Address map
   // NOTE: the internal address space is chosen by default by the system bus,
@@ -84,6 +148,27 @@ package sap_pkg;
       }
   };
 
+  //Tightly coupled memory (private per hart, same address on every hart)
+  //--------------------
+  localparam bit TCM_ENABLE = 1'b0;
+  localparam logic [31:0] TCM_START_ADDRESS = GLOBAL_BASE_ADDRESS + 32'h40000;
+  localparam logic [31:0] TCM_SIZE = 32'h00002000;
+  localparam logic [31:0] TCM_END_ADDRESS = TCM_START_ADDRESS + TCM_SIZE;
+  localparam logic [31:0] DEMUX_INSTR_TCM_IDX = 32'd1;
+
+  localparam addr_map_rule_t [1:0] DEMUX_INT_SAFE_REG_TCM_ADDR_RULES = '{
+      '{
+          idx: DEMUX_SAFE_CPU_REGISTER_IDX,
+          start_addr: SAFE_CPU_REGISTER_START_ADDRESS,
+          end_addr: SAFE_CPU_REGISTER_END_ADDRESS
+      },
+      '{idx: DEMUX_TCM_IDX, start_addr: TCM_START_ADDRESS, end_addr: TCM_END_ADDRESS}
+  };
+
+  localparam addr_map_rule_t [0:0] DEMUX_INSTR_TCM_ADDR_RULES = '{
+      '{idx: DEMUX_INSTR_TCM_IDX, start_addr: TCM_START_ADDRESS, end_addr: TCM_END_ADDRESS}
+  };
+
   //Internal Memory Map and Index
   //--------------------
   localparam int unsigned LOG_SYSTEM_XBAR_NMASTER = SYSTEM_XBAR_NMASTER > 1 ? $clog2(
@@ -103,79 +188,95 @@ package sap_pkg;
   localparam logic [31:0] PERIPHERAL_END_ADDRESS = PERIPHERAL_START_ADDRESS + PERIPHERAL_SIZE;
   localparam logic [31:0] PERIPHERAL_IDX = 32'd1;
 
-  localparam logic [31:0] EXTERNAL_PERIPHERAL_START_ADDRESS = 32'h19030000;/*X-HEEP VERSION32'h00000000;*/
+  localparam logic [31:0] EXTERNAL_PERIPHERAL_START_ADDRESS = 32'h1A000000;/*X-HEEP VERSION32'h00000000;*/
   localparam logic [31:0] EXTERNAL_PERIPHERAL_SIZE = 32'h00001000;/*X-HEEP VERSION32'h41000000;*/
   localparam logic [31:0] EXTERNAL_PERIPHERAL_END_ADDRESS = EXTERNAL_PERIPHERAL_START_ADDRESS + EXTERNAL_PERIPHERAL_SIZE;
   localparam logic [31:0] EXTERNAL_PERIPHERAL_IDX = 32'd2;
 
-  localparam logic [31:0] MEMORY_RAM0_START_ADDRESS = GLOBAL_BASE_ADDRESS + 32'h00020000;
-  localparam logic [31:0] MEMORY_RAM0_SIZE = 32'h00008000;
-  localparam logic [31:0] MEMORY_RAM0_END_ADDRESS = MEMORY_RAM0_START_ADDRESS + MEMORY_RAM0_SIZE;
+  //RAM bank i -> MEMORY_RAM0_IDX + i, one rule per bank (address slices of MEMORY_BANK_SIZE).
+  //When interleaved the system xbar replaces the decoded bank by the interleaving bits.
+  localparam logic [31:0] MEMORY_START_ADDRESS = GLOBAL_BASE_ADDRESS + 32'h00020000;
+  localparam logic [31:0] MEMORY_BANK_SIZE = MEM_BANK_SIZE;
+  localparam logic [31:0] MEMORY_END_ADDRESS = MEMORY_START_ADDRESS + MEM_SIZE;
   localparam logic [31:0] MEMORY_RAM0_IDX = 32'd3;
 
-  localparam logic [31:0] MEMORY_RAM1_START_ADDRESS = GLOBAL_BASE_ADDRESS + 32'h00028000;
-  localparam logic [31:0] MEMORY_RAM1_SIZE = 32'h00008000;
-  localparam logic [31:0] MEMORY_RAM1_END_ADDRESS = MEMORY_RAM1_START_ADDRESS + MEMORY_RAM1_SIZE;
-  localparam logic [31:0] MEMORY_RAM1_IDX = 32'd4;
-
 //  localparam logic [31:0] SAFE_CPU_REGISTER_START_ADDRESS = GLOBAL_BASE_ADDRESS + 32'h00012000;
 //  localparam logic [31:0] SAFE_CPU_REGISTER_SIZE = 32'h0000100;
 //  localparam logic [31:0] SAFE_CPU_REGISTER_END_ADDRESS = SAFE_CPU_REGISTER_START_ADDRESS + SAFE_CPU_REGISTER_SIZE;
 //  localparam logic [31:0] SAFE_CPU_REGISTER_IDX = 32'd5;
 
-  localparam GLOBAL_END_ADDRESS = GLOBAL_BASE_ADDRESS + MEMORY_RAM1_END_ADDRESS;
-
-  localparam addr_map_rule_t [SYSTEM_XBAR_NSLAVE-1:0] XBAR_ADDR_RULES = '{
-      '{idx: ERROR_IDX, start_addr: ERROR_START_ADDRESS, end_addr: ERROR_END_ADDRESS},
-      '{
-          idx: PERIPHERAL_IDX,
-          start_addr: PERIPHERAL_START_ADDRESS,
-          end_addr: PERIPHERAL_END_ADDRESS
-      },
-      '{
-          idx: EXTERNAL_PERIPHERAL_IDX,
-          start_addr: EXTERNAL_PERIPHERAL_START_ADDRESS,
-          end_addr: EXTERNAL_PERIPHERAL_END_ADDRESS
-      },
-      '{
-          idx: MEMORY_RAM0_IDX,
-          start_addr: MEMORY_RAM0_START_ADDRESS,
-          end_addr: MEMORY_RAM0_END_ADDRESS
-      },
-      '{
-          idx: MEMORY_RAM1_IDX,
-          start_addr: MEMORY_RAM1_START_ADDRESS,
-          end_addr: MEMORY_RAM1_END_ADDRESS
-      }//,
-/*      '{
-          idx: SAFE_CPU_REGISTER_IDX,
-          start_addr: SAFE_CPU_REGISTER_START_ADDRESS,
-          end_addr: SAFE_CPU_REGISTER_END_ADDRESS
-      }*/
-  };
+  localparam GLOBAL_END_ADDRESS = GLOBAL_BASE_ADDRESS + MEMORY_END_ADDRESS;
+
+  function automatic addr_map_rule_t [SYSTEM_XBAR_NRULES-1:0] gen_xbar_addr_rules();
+    addr_map_rule_t [SYSTEM_XBAR_NRULES-1:0] rules;
+    rules[ERROR_IDX] = '{
+        idx: ERROR_IDX,
+        start_addr: ERROR_START_ADDRESS,
+        end_addr: ERROR_END_ADDRESS
+    };
+    rules[PERIPHERAL_IDX] = '{
+        idx: PERIPHERAL_IDX,
+        start_addr: PERIPHERAL_START_ADDRESS,
+        end_addr: PERIPHERAL_END_ADDRESS
+    };
+    rules[EXTERNAL_PERIPHERAL_IDX] = '{
+        idx: EXTERNAL_PERIPHERAL_IDX,
+        start_addr: EXTERNAL_PERIPHERAL_START_ADDRESS,
+        end_addr: EXTERNAL_PERIPHERAL_END_ADDRESS
+    };
+    for (int unsigned i = 0; i < NUM_BANKS; i++) begin
+      rules[MEMORY_RAM0_IDX+i] = '{
+          idx: MEMORY_RAM0_IDX + i,
+          start_addr: MEMORY_START_ADDRESS + i * MEMORY_BANK_SIZE,
+          end_addr: MEMORY_START_ADDRESS + (i + 1) * MEMORY_BANK_SIZE
+      };
+    end
+    return rules;
+  endfunction
+
+  localparam addr_map_rule_t [SYSTEM_XBAR_NRULES-1:0] XBAR_ADDR_RULES = gen_xbar_addr_rules();
 
   //Peripherals
   //-----------
 
-  localparam PERIPHERALS = 1;
+  localparam PERIPHERALS = 2;
 
   localparam logic [31:0] DEBUG_BOOTROM_START_ADDRESS = PERIPHERAL_START_ADDRESS + 32'h00000000;
   localparam logic [31:0] DEBUG_BOOTROM_SIZE = 32'h00001000;
   localparam logic [31:0] DEBUG_BOOTROM_END_ADDRESS = DEBUG_BOOTROM_START_ADDRESS + DEBUG_BOOTROM_SIZE;
   localparam logic [31:0] DEBUG_BOOTROM_IDX = 32'd0;
 
+  localparam logic [31:0] DMA_START_ADDRESS = PERIPHERAL_START_ADDRESS + 32'h00001000;
+  localparam logic [31:0] DMA_SIZE = 32'h00001000;
+  localparam logic [31:0] DMA_END_ADDRESS = DMA_START_ADDRESS + DMA_SIZE;
+  localparam logic [31:0] DMA_IDX = 32'd1;
+
   localparam addr_map_rule_t [PERIPHERALS-1:0] PERIPHERALS_ADDR_RULES = '{
       '{
           idx: DEBUG_BOOTROM_IDX,
           start_addr: DEBUG_BOOTROM_START_ADDRESS,
           end_addr: DEBUG_BOOTROM_END_ADDRESS
-      }
+      },
+      '{idx: DMA_IDX, start_addr: DMA_START_ADDRESS, end_addr: DMA_END_ADDRESS}
   };
 
   localparam int unsigned PERIPHERALS_PORT_SEL_WIDTH = PERIPHERALS > 1 ? $clog2(
       PERIPHERALS
   ) : 32'd1;
 
+  //Boot ROM instruction port (sap_boot_rom) in front of each core instruction demux
+  localparam bit BOOTROM_PORT = 1'b1;
+  localparam bit BOOTROM_PER_HART = 1'b1;  //0: one ROM shared by the harts
+  localparam logic [31:0] DEMUX_INSTR_ROM_IDX = 32'd1;
+
+  localparam addr_map_rule_t [0:0] DEMUX_INSTR_ROM_ADDR_RULES = '{
+      '{
+          idx: DEMUX_INSTR_ROM_IDX,
+          start_addr: DEBUG_BOOTROM_START_ADDRESS,
+          end_addr: DEBUG_BOOTROM_END_ADDRESS
+      }
+  };
+
 
   //Private Memory CPU
   localparam logic [31:0] CPU_REG_START_ADDRESS = GLOBAL_BASE_ADDRESS; //Todo modificar la reg privada
@@ -197,4 +298,15 @@ package sap_pkg;
   //DEBUG SYSTEM
   localparam int unsigned DEBUG_SYSTEM_START_START_ADDRESS = 32'h10000000;
 
+  //Multi-cluster (sap_cluster_array)
+  //Cluster k memory window: GLOBAL_BASE_ADDRESS + k*CLUSTER_MEM_STRIDE
+  //Cluster k CSR window: SAFE_CSR_BASE_ADDRESS + k*CLUSTER_CSR_STRIDE
+  localparam int unsigned MAX_CLUSTERS = 8;
+  localparam logic [31:0] CLUSTER_MEM_STRIDE = 32'h100000;
+  localparam logic [31:0] CLUSTER_CSR_STRIDE = 32'h00001000;
+
+  localparam logic [31:0] DISPATCHER_START_ADDRESS = SAFE_CSR_BASE_ADDRESS + 32'h00010000;
+  localparam logic [31:0] DISPATCHER_SIZE = 32'h00001000;
+  localparam logic [31:0] DISPATCHER_END_ADDRESS = DISPATCHER_START_ADDRESS + DISPATCHER_SIZE;
+
 endpackage
\ No newline at end of file
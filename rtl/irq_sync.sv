@@ -0,0 +1,65 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Synchronizer of the external interrupt lines of a redundancy group.
+//  - The lines are latched and only updated at a fetch boundary: an accepted
+//    instruction request (voted, the same for every member) or while the
+//    hart sleeps, so wfi still wakes up on the interrupt.
+//  - Harts in group_i (TCLS or DCLS pair) share the copy updated at the
+//    boundaries of the master, every member sees a change at the same fetch.
+//    A line of any member is raised to the whole group.
+//    The other harts update their own copy of their own line at their own
+//    boundaries.
+//  - The trailing core of a delayed lockstep takes the master copy through
+//    the lockstep delay of safe_cpu_group.
+
+module irq_sync #(
+    parameter NHARTS = 3,
+    parameter NIRQ   = 1
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input logic [NHARTS-1:0][NIRQ-1:0] irq_i,
+
+    input logic [NHARTS-1:0] group_i,
+    input logic [NHARTS-1:0] master_i,
+    input logic [NHARTS-1:0] fetch_i,
+    input logic [NHARTS-1:0] sleep_i,
+
+    output logic [NHARTS-1:0][NIRQ-1:0] irq_o
+);
+
+  logic [NHARTS-1:0][NIRQ-1:0] hart_irq_q;
+  logic [NIRQ-1:0] group_irq_q;
+  logic [NIRQ-1:0] group_irq_s;
+  logic [NHARTS-1:0] boundary;
+
+  assign boundary = fetch_i | sleep_i;
+
+  always_comb begin
+    group_irq_s = '0;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (group_i[i]) group_irq_s |= irq_i[i];
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      hart_irq_q  <= '0;
+      group_irq_q <= '0;
+    end else begin
+      for (int unsigned i = 0; i < NHARTS; i++) begin
+        if (boundary[i]) hart_irq_q[i] <= irq_i[i];
+      end
+      if (|(boundary & master_i)) group_irq_q <= group_irq_s;
+    end
+  end
+
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_irq
+    assign irq_o[i] = group_i[i] ? group_irq_q : hart_irq_q[i];
+  end
+
+endmodule
@@ -0,0 +1,261 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Loose lockstep of a DMR pair ([0] leading core, [1] trailing core).
+//  - The leading core owns the bus. Its data responses are pushed into a
+//    replay FIFO and the trailing core reads its data responses from there,
+//    so the trailing core never reaches the bus for data and may run up to
+//    FIFO_DEPTH accesses behind.
+//  - Both cores fetch on the instruction port (arbitrated): fetches are
+//    speculative and not part of the signature.
+//  - Every data request (addr, we, be, wdata of stores) is folded into a
+//    CRC-32 per core. The signatures are compared every interval_i requests
+//    (0: never) and before every store outside the RAM, which is held until
+//    the trailing core issues the same store.
+//  - The interrupt and debug lines of the trailing core (intr_i, debug_req_i)
+//    are tagged with the data request count of the leading core when they
+//    change, and reach the trailing core (intr_o, debug_req_o) once it has
+//    issued the same number of requests. Its next request waits for them.
+//  - error_o is sticky until enable_i is released.
+
+module lockstep_loose #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned FIFO_DEPTH = sap_pkg::LOCKSTEP_FIFO_DEPTH,
+    parameter logic [31:0] START_ADDR = sap_pkg::MEMORY_START_ADDRESS,
+    parameter logic [31:0] END_ADDR   = sap_pkg::MEMORY_END_ADDRESS
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    input logic enable_i,
+
+    input logic [23:0] interval_i,
+
+    // Interrupt and debug lines of the trailing core
+    input  logic [31:0] intr_i,
+    input  logic        debug_req_i,
+    output logic [31:0] intr_o,
+    output logic        debug_req_o,
+
+    // Cores
+    input  obi_req_t  [1:0] core_instr_req_i,
+    output obi_resp_t [1:0] core_instr_resp_o,
+    input  obi_req_t  [1:0] core_data_req_i,
+    output obi_resp_t [1:0] core_data_resp_o,
+
+    // Bus
+    output obi_req_t  instr_req_o,
+    input  obi_resp_t instr_resp_i,
+    output obi_req_t  data_req_o,
+    input  obi_resp_t data_resp_i,
+
+    output logic error_o
+);
+
+  localparam int unsigned CntWidth = $clog2(FIFO_DEPTH + 1);
+
+  typedef logic [CntWidth-1:0] cnt_t;
+  //Request count tags, one bit wider than the largest lead of the leading core
+  typedef logic [CntWidth:0] tag_t;
+
+  //CRC-32 (0x04C11DB7) of one data request
+  function automatic logic [31:0] crc_step(logic [31:0] crc, obi_req_t req);
+    logic [68:0] data;
+    data = {req.addr, req.we ? req.wdata : 32'h0, req.be, req.we};
+    for (int i = 68; i >= 0; i--) begin
+      crc = {crc[30:0], 1'b0} ^ ((crc[31] ^ data[i]) ? 32'h04C11DB7 : 32'h0);
+    end
+    return crc;
+  endfunction
+
+  //Signatures and progress
+  logic [31:0] lead_crc_q, trail_crc_q, snap_crc_q;
+  logic [31:0] lead_crc_d, trail_crc_d;
+  cnt_t pending_q;  //FIFO entries + leading requests in flight
+  cnt_t ahead_q, ahead_d;  //leading requests not yet issued by the trailing core
+  cnt_t snap_left_q;
+  logic snap_valid_q;
+  logic [23:0] since_q;
+  logic [1:0] trail_out_q;
+  logic error_q;
+
+  logic lead_gnt, trail_gnt, trail_rvalid;
+  logic boundary, uncached_store, store_check, store_ok, hold;
+  logic fifo_empty;
+  logic [31:0] fifo_rdata;
+
+  //Interrupt and debug lines
+  tag_t lead_cnt_q, trail_cnt_q;
+  logic [32:0] lines_q, ev_lines;
+  tag_t ev_tag;
+  logic ev_push, ev_due, ev_full, ev_empty;
+
+  //***Instruction: both cores on the bus port***//
+  sap_xbar_varlat_n_to_one #(
+      .obi_req_t   (obi_req_t),
+      .obi_resp_t  (obi_resp_t),
+      .XBAR_NMASTER(2)
+  ) instr_mux_i (
+      .clk_i,
+      .rst_ni,
+      .rr_i         ('0),
+      .master_req_i (core_instr_req_i),
+      .master_resp_o(core_instr_resp_o),
+      .slave_req_o  (instr_req_o),
+      .slave_resp_i (instr_resp_i)
+  );
+
+  //***Data: leading core***//
+  assign uncached_store = core_data_req_i[0].req && core_data_req_i[0].we &&
+                          !((core_data_req_i[0].addr >= START_ADDR) && (core_data_req_i[0].addr < END_ADDR));
+  assign boundary = (interval_i != '0) && (since_q == interval_i - 1'b1);
+
+  //Same check as dmr_comparator on the held store
+  assign store_check = uncached_store && (ahead_q == '0) && core_data_req_i[1].req;
+  assign store_ok = (lead_crc_q == trail_crc_q) &&
+                    (core_data_req_i[0].addr == core_data_req_i[1].addr) &&
+                    (core_data_req_i[0].wdata == core_data_req_i[1].wdata) &&
+                    (core_data_req_i[0].be == core_data_req_i[1].be) &&
+                    (core_data_req_i[0].we == core_data_req_i[1].we);
+
+  assign hold = !enable_i || error_q || (pending_q == cnt_t'(FIFO_DEPTH)) || ev_full ||
+                (boundary && snap_valid_q) || (uncached_store && !(store_check && store_ok));
+
+  always_comb begin
+    data_req_o = core_data_req_i[0];
+    if (hold) data_req_o.req = 1'b0;
+  end
+
+  assign lead_gnt = data_req_o.req && data_resp_i.gnt;
+  assign core_data_resp_o[0] = '{gnt: lead_gnt, rvalid: data_resp_i.rvalid, rdata: data_resp_i.rdata};
+
+  fifo_v3 #(
+      .DEPTH     (FIFO_DEPTH),
+      .DATA_WIDTH(32)
+  ) replay_fifo_i (
+      .clk_i,
+      .rst_ni,
+      .flush_i   (!enable_i),
+      .testmode_i(1'b0),
+      .full_o    (),
+      .empty_o   (fifo_empty),
+      .usage_o   (),
+      .data_i    (data_resp_i.rdata),
+      .push_i    (enable_i && data_resp_i.rvalid),
+      .data_o    (fifo_rdata),
+      .pop_i     (trail_rvalid)
+  );
+
+  //***Data: trailing core***//
+  assign trail_gnt = enable_i && !error_q && core_data_req_i[1].req && (ahead_q != '0) &&
+                     (trail_out_q != 2'b11) && !ev_due;
+  assign trail_rvalid = (trail_out_q != '0) && !fifo_empty;
+  assign core_data_resp_o[1] = '{gnt: trail_gnt, rvalid: trail_rvalid, rdata: fifo_rdata};
+
+  //***Interrupt and debug lines: tagged with the leading request count***//
+  //A change seen while the event FIFO is full is pushed once there is room,
+  //the leading core is held meanwhile so the tag stays the same
+  assign ev_push = enable_i && !ev_full && ({debug_req_i, intr_i} != lines_q);
+  assign ev_due  = !ev_empty && (ev_tag == trail_cnt_q);
+
+  fifo_v3 #(
+      .DEPTH     (FIFO_DEPTH),
+      .DATA_WIDTH(33 + CntWidth + 1)
+  ) event_fifo_i (
+      .clk_i,
+      .rst_ni,
+      .flush_i   (!enable_i),
+      .testmode_i(1'b0),
+      .full_o    (ev_full),
+      .empty_o   (ev_empty),
+      .usage_o   (),
+      .data_i    ({lead_cnt_q + tag_t'(lead_gnt), debug_req_i, intr_i}),
+      .push_i    (ev_push),
+      .data_o    ({ev_tag, ev_lines}),
+      .pop_i     (ev_due)
+  );
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      lead_cnt_q  <= '0;
+      trail_cnt_q <= '0;
+      lines_q     <= '0;
+      intr_o      <= '0;
+      debug_req_o <= 1'b0;
+    end else if (!enable_i) begin
+      //Tight lockstep lines until the pair is loose
+      lead_cnt_q  <= '0;
+      trail_cnt_q <= '0;
+      lines_q     <= {debug_req_i, intr_i};
+      {debug_req_o, intr_o} <= {debug_req_i, intr_i};
+    end else begin
+      lead_cnt_q  <= lead_cnt_q + tag_t'(lead_gnt);
+      trail_cnt_q <= trail_cnt_q + tag_t'(trail_gnt);
+      if (ev_push) lines_q <= {debug_req_i, intr_i};
+      if (ev_due) {debug_req_o, intr_o} <= ev_lines;
+    end
+  end
+
+  //***Signatures***//
+  assign lead_crc_d  = crc_step(lead_crc_q, core_data_req_i[0]);
+  assign trail_crc_d = crc_step(trail_crc_q, core_data_req_i[1]);
+  assign ahead_d     = ahead_q + cnt_t'(lead_gnt) - cnt_t'(trail_gnt);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      lead_crc_q   <= '0;
+      trail_crc_q  <= '0;
+      snap_crc_q   <= '0;
+      pending_q    <= '0;
+      ahead_q      <= '0;
+      snap_left_q  <= '0;
+      snap_valid_q <= 1'b0;
+      since_q      <= '0;
+      trail_out_q  <= '0;
+      error_q      <= 1'b0;
+    end else if (!enable_i) begin
+      lead_crc_q   <= '0;
+      trail_crc_q  <= '0;
+      pending_q    <= '0;
+      ahead_q      <= '0;
+      snap_valid_q <= 1'b0;
+      since_q      <= '0;
+      trail_out_q  <= '0;
+      error_q      <= 1'b0;
+    end else begin
+      ahead_q     <= ahead_d;
+      pending_q   <= pending_q + cnt_t'(lead_gnt) - cnt_t'(trail_rvalid);
+      trail_out_q <= trail_out_q + 2'(trail_gnt) - 2'(trail_rvalid);
+
+      if (store_check && !store_ok) error_q <= 1'b1;
+
+      if (lead_gnt) begin
+        lead_crc_q <= lead_crc_d;
+        since_q    <= boundary ? '0 : since_q + 1'b1;
+      end
+
+      if (trail_gnt) begin
+        trail_crc_q <= trail_crc_d;
+        if (snap_valid_q) begin
+          snap_left_q <= snap_left_q - 1'b1;
+          if (snap_left_q == cnt_t'(1)) begin
+            snap_valid_q <= 1'b0;
+            if (trail_crc_d != snap_crc_q) error_q <= 1'b1;
+          end
+        end
+      end
+
+      //Interval checkpoint of the leading core
+      if (lead_gnt && boundary) begin
+        snap_valid_q <= 1'b1;
+        snap_crc_q   <= lead_crc_d;
+        snap_left_q  <= ahead_d;
+      end
+    end
+  end
+
+  assign error_o = error_q;
+
+endmodule
@@ -6,11 +6,14 @@
 module lockstep_reg #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NCYCLES = 2
+    parameter NCYCLES = 2,  //maximum delay
+    // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
+    parameter int unsigned DelayWidth = $clog2(NCYCLES + 1)
 ) (
     input logic clk_i,
     input logic rst_ni,
     input logic enable_i,
+    input logic [DelayWidth-1:0] delay_i,  //1..NCYCLES, latched while disabled
 
     input  obi_req_t [1:0] core_instr_req_i,
     output obi_req_t [1:0] core_instr_req_o,
@@ -27,6 +30,7 @@ module lockstep_reg #(
 
   logic pipe_data_gnt, pipe_instr_gnt;
   logic                         enable_ff;
+  logic     [DelayWidth-1:0]    delay_q;
   //TODO: remove gnt that is not used for returned resp delayed
   obi_req_t                     core_instr_req_ff;
   logic     [NCYCLES-1:0]       core_instr_resp_ff_rvalid;
@@ -36,68 +40,49 @@ module lockstep_reg #(
   logic     [NCYCLES-1:0]       core_data_resp_ff_rvalid;
   logic     [NCYCLES-1:0][31:0] core_data_resp_ff_rdata;
 
+  //The delay only follows delay_i while disabled, changes while enabled are ignored
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      delay_q <= DelayWidth'(1);
+    end else if (!enable_i) begin
+      delay_q <= delay_i;
+    end
+  end
+
   for (genvar i = 0; i < 2; i++) begin : Nharts_delayed_mux
 
     if (i == 0) begin
-      if (NCYCLES == 1) begin
-        // Instruction
-        obi_sngreg #(
-            .obi_req_t            (obi_req_t  ),
-            .obi_resp_t           (obi_resp_t )
-        )obi_sngreg0_i (
-            .clk_i,
-            .rst_ni,
-            .clear_pipeline       (~enable_i),
-            .core_instr_req_i     (core_instr_req_i[0]),
-            .core_instr_req_o     (core_instr_req_ff),
-            .core_instr_resp_gnt_i(core_instr_resp_i.gnt),
-            .core_instr_resp_gnt_o(pipe_instr_gnt)
-        );
+      // Instruction
+      obi_pipelined_delay #(
+          .obi_req_t            (obi_req_t  ),
+          .obi_resp_t           (obi_resp_t ),
+          .NDELAY(NCYCLES)
+      ) obi_pipelined_delay0_i (
+          .clk_i,
+          .rst_ni,
+          .clear_pipeline       (~enable_i),
+          .delay_i              (delay_q),
+          .core_instr_req_i     (core_instr_req_i[0]),
+          .core_instr_req_o     (core_instr_req_ff),
+          .core_instr_resp_gnt_i(core_instr_resp_i.gnt),
+          .core_instr_resp_gnt_o(pipe_instr_gnt)
+      );
 
-        // Data
-        obi_sngreg #(
-            .obi_req_t            (obi_req_t  ),
-            .obi_resp_t           (obi_resp_t )
-        )obi_sngreg1_i (
-            .clk_i,
-            .rst_ni,
-            .clear_pipeline       (~enable_i),
-            .core_instr_req_i     (core_data_req_i[0]),
-            .core_instr_req_o     (core_data_req_ff),
-            .core_instr_resp_gnt_i(core_data_resp_i.gnt),
-            .core_instr_resp_gnt_o(pipe_data_gnt)
-        );
-
-      end else begin
-        obi_pipelined_delay #(
-            .obi_req_t            (obi_req_t  ),
-            .obi_resp_t           (obi_resp_t ),
-            .NDELAY(NCYCLES)
-        ) obi_pipelined_delay0_i (
-            .clk_i,
-            .rst_ni,
-            .clear_pipeline       (~enable_i),
-            .core_instr_req_i     (core_instr_req_i[0]),
-            .core_instr_req_o     (core_instr_req_ff),
-            .core_instr_resp_gnt_i(core_instr_resp_i.gnt),
-            .core_instr_resp_gnt_o(pipe_instr_gnt)
-        );
-
-        // Data
-        obi_pipelined_delay #(
-            .obi_req_t            (obi_req_t  ),
-            .obi_resp_t           (obi_resp_t ),
-            .NDELAY(NCYCLES)
-        ) obi_pipelined_delay1_i (
-            .clk_i,
-            .rst_ni,
-            .clear_pipeline       (~enable_i),
-            .core_instr_req_i     (core_data_req_i[0]),
-            .core_instr_req_o     (core_data_req_ff),
-            .core_instr_resp_gnt_i(core_data_resp_i.gnt),
-            .core_instr_resp_gnt_o(pipe_data_gnt)
-        );
-      end
+      // Data
+      obi_pipelined_delay #(
+          .obi_req_t            (obi_req_t  ),
+          .obi_resp_t           (obi_resp_t ),
+          .NDELAY(NCYCLES)
+      ) obi_pipelined_delay1_i (
+          .clk_i,
+          .rst_ni,
+          .clear_pipeline       (~enable_i),
+          .delay_i              (delay_q),
+          .core_instr_req_i     (core_data_req_i[0]),
+          .core_instr_req_o     (core_data_req_ff),
+          .core_instr_resp_gnt_i(core_data_resp_i.gnt),
+          .core_instr_resp_gnt_o(pipe_data_gnt)
+      );
     end
 
     //Signal assignment
@@ -112,8 +97,8 @@ module lockstep_reg #(
       assign core_data_resp_o[0].gnt     = pipe_data_gnt;
     end else begin
       assign core_instr_req_o[1] = core_instr_req_i[1];
-      assign core_instr_resp_o[1].rdata = core_instr_resp_ff_rdata[NCYCLES-1];
-      assign core_instr_resp_o[1].rvalid = core_instr_resp_ff_rvalid[NCYCLES-1];
+      assign core_instr_resp_o[1].rdata = core_instr_resp_ff_rdata[delay_q-1];
+      assign core_instr_resp_o[1].rvalid = core_instr_resp_ff_rvalid[delay_q-1];
       assign core_instr_resp_o[1].gnt = core_instr_resp_i.gnt;
       assign core_data_req_o[1].addr = core_data_req_i[1].addr;
       assign core_data_req_o[1].req = core_data_req_i[1].req;
@@ -122,8 +107,8 @@ module lockstep_reg #(
       // when the buffered [0] req is granted the we is put to '0' in the output, while the output of [1] still one
       assign core_data_req_o[1].we = core_data_req_i[1].we & core_data_req_i[1].req;
 
-      assign core_data_resp_o[1].rdata = core_data_resp_ff_rdata[NCYCLES-1];
-      assign core_data_resp_o[1].rvalid = core_data_resp_ff_rvalid[NCYCLES-1];
+      assign core_data_resp_o[1].rdata = core_data_resp_ff_rdata[delay_q-1];
+      assign core_data_resp_o[1].rvalid = core_data_resp_ff_rvalid[delay_q-1];
       assign core_data_resp_o[1].gnt = core_data_resp_i.gnt;
     end
   end
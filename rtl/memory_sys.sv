@@ -6,57 +6,107 @@
 module memory_sys #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NUM_BANKS = 2
+    parameter NUM_BANKS = sap_pkg::NUM_BANKS,
+    parameter int unsigned BANK_SIZE = sap_pkg::MEM_SIZE / NUM_BANKS,
+    //Dual port banks: port B of bank i at ram_req_i[NUM_BANKS+i]
+    parameter int unsigned NUM_PORTS = sap_pkg::MEM_PORTS,
+    //SECDED banks (sap_mem_ecc), single port only
+    parameter bit ECC = sap_pkg::MEM_ECC
 ) (
     input logic clk_i,
     input logic rst_ni,
 
-    input  obi_req_t  [NUM_BANKS-1:0] ram_req_i,
-    output obi_resp_t [NUM_BANKS-1:0] ram_resp_o,
+    input  obi_req_t  [NUM_PORTS*NUM_BANKS-1:0] ram_req_i,
+    output obi_resp_t [NUM_PORTS*NUM_BANKS-1:0] ram_resp_o,
 
     // power manager signals that goes to the ASIC macros
     input  logic [NUM_BANKS-1:0] pwrgate_ni,
     output logic [NUM_BANKS-1:0] pwrgate_ack_no,
-    input  logic [NUM_BANKS-1:0] set_retentive_ni
+    input  logic [NUM_BANKS-1:0] set_retentive_ni,
+
+    // ECC scrubber and error report
+    input  logic                 scrub_en_i,
+    output logic [NUM_BANKS-1:0] ecc_corrected_o,
+    output logic [NUM_BANKS-1:0] ecc_uncorrected_o
 
 );
-  logic [NUM_BANKS-1:0] ram_valid_q;
+  logic [NUM_PORTS*NUM_BANKS-1:0] ram_valid_q;
+
+  localparam int NumWords = BANK_SIZE / 4;
+  localparam int AddrWidth = $clog2(BANK_SIZE);
 
-  localparam int NumWords = 32 * 1024 / 4;
-  localparam int AddrWidth = $clog2(32 * 1024);
+  if (ECC && NUM_PORTS != 1) begin : gen_ecc_error
+    $error("memory_sys: ECC banks are single port (MEM_PORTS = 1)");
+  end
 
   for (genvar i = 0; i < NUM_BANKS; i++) begin : gen_sram
 
-    always_ff @(posedge clk_i or negedge rst_ni) begin
-      if (!rst_ni) begin
-        ram_valid_q[i] <= '0;
-      end else begin
-        ram_valid_q[i] <= ram_resp_o[i].gnt;
+    if (ECC) begin : gen_ecc
+      sap_mem_ecc #(
+          .obi_req_t (obi_req_t),
+          .obi_resp_t(obi_resp_t),
+          .NumWords  (NumWords)
+      ) mem_i (
+          .clk_i,
+          .rst_ni,
+          .req_i(ram_req_i[i]),
+          .resp_o(ram_resp_o[i]),
+          .scrub_en_i,
+          .corrected_o(ecc_corrected_o[i]),
+          .uncorrected_o(ecc_uncorrected_o[i]),
+          .pwrgate_ni(pwrgate_ni[i]),
+          .pwrgate_ack_no(pwrgate_ack_no[i]),
+          .set_retentive_ni(set_retentive_ni[i])
+      );
+    end else begin : gen_no_ecc
+
+      logic [NUM_PORTS-1:0] port_req, port_we;
+      logic [NUM_PORTS-1:0][AddrWidth-3:0] port_addr;
+      logic [NUM_PORTS-1:0][31:0] port_wdata, port_rdata;
+      logic [NUM_PORTS-1:0][3:0] port_be;
+
+      for (genvar p = 0; p < NUM_PORTS; p++) begin : gen_port
+        always_ff @(posedge clk_i or negedge rst_ni) begin
+          if (!rst_ni) begin
+            ram_valid_q[p*NUM_BANKS+i] <= '0;
+          end else begin
+            ram_valid_q[p*NUM_BANKS+i] <= ram_resp_o[p*NUM_BANKS+i].gnt;
+          end
+        end
+
+        assign ram_resp_o[p*NUM_BANKS+i].gnt = ram_req_i[p*NUM_BANKS+i].req;
+        assign ram_resp_o[p*NUM_BANKS+i].rvalid = ram_valid_q[p*NUM_BANKS+i];
+        assign ram_resp_o[p*NUM_BANKS+i].rdata = port_rdata[p];
+
+        assign port_req[p] = ram_req_i[p*NUM_BANKS+i].req;
+        assign port_we[p] = ram_req_i[p*NUM_BANKS+i].we;
+        assign port_addr[p] = ram_req_i[p*NUM_BANKS+i].addr[AddrWidth-1:2];
+        assign port_wdata[p] = ram_req_i[p*NUM_BANKS+i].wdata;
+        assign port_be[p] = ram_req_i[p*NUM_BANKS+i].be;
       end
-    end
 
-    assign ram_resp_o[i].gnt = ram_req_i[i].req;
-    assign ram_resp_o[i].rvalid = ram_valid_q[i];
-
-
-
-    //Fixed to 8KWords per bank (32KB)
-    sram_wrapper #(
-        .NumWords (NumWords),
-        .DataWidth(32'd32)
-    ) mem_i (
-        .clk_i(clk_i),
-        .rst_ni(rst_ni),
-        .req_i(ram_req_i[i].req),
-        .we_i(ram_req_i[i].we),
-        .addr_i(ram_req_i[i].addr[AddrWidth-1:2]),
-        .wdata_i(ram_req_i[i].wdata),
-        .be_i(ram_req_i[i].be),
-        .pwrgate_ni(pwrgate_ni[i]),
-        .pwrgate_ack_no(pwrgate_ack_no[i]),
-        .set_retentive_ni(set_retentive_ni[i]),
-        .rdata_o(ram_resp_o[i].rdata)
-    );
+      //BANK_SIZE bytes per bank (Memory.BankSize in configs/addr.hjson)
+      sram_wrapper #(
+          .NumWords (NumWords),
+          .DataWidth(32'd32),
+          .NumPorts (NUM_PORTS)
+      ) mem_i (
+          .clk_i(clk_i),
+          .rst_ni(rst_ni),
+          .req_i(port_req),
+          .we_i(port_we),
+          .addr_i(port_addr),
+          .wdata_i(port_wdata),
+          .be_i(port_be),
+          .pwrgate_ni(pwrgate_ni[i]),
+          .pwrgate_ack_no(pwrgate_ack_no[i]),
+          .set_retentive_ni(set_retentive_ni[i]),
+          .rdata_o(port_rdata)
+      );
+
+      assign ecc_corrected_o[i]   = 1'b0;
+      assign ecc_uncorrected_o[i] = 1'b0;
+    end
   end
 
 endmodule
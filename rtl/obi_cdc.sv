@@ -0,0 +1,98 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// OBI clock domain crossing with two cdc_fifo_gray (request and response).
+// The source side only grants while there is room for the response, so the
+// response FIFO never back-pressures the destination rvalid.
+
+module obi_cdc #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned LOG_DEPTH    = 2
+) (
+    // Source (master side)
+    input  logic      src_clk_i,
+    input  logic      src_rst_ni,
+    input  obi_req_t  src_req_i,
+    output obi_resp_t src_resp_o,
+
+    // Destination (slave side)
+    input  logic      dst_clk_i,
+    input  logic      dst_rst_ni,
+    output obi_req_t  dst_req_o,
+    input  obi_resp_t dst_resp_i
+);
+
+  localparam int unsigned Depth = 2 ** LOG_DEPTH;
+
+  logic req_ready, req_valid;
+  logic rsp_valid;
+  obi_req_t req_data;
+  logic [31:0] rsp_rdata;
+
+  logic [LOG_DEPTH:0] outstanding_q;
+  logic src_gnt;
+
+  //Source side
+  assign src_gnt = src_req_i.req && req_ready && (outstanding_q != Depth);
+
+  always_comb begin
+    src_resp_o        = '0;
+    src_resp_o.gnt    = src_gnt;
+    src_resp_o.rvalid = rsp_valid;
+    src_resp_o.rdata  = rsp_rdata;
+  end
+
+  always_ff @(posedge src_clk_i or negedge src_rst_ni) begin
+    if (!src_rst_ni) begin
+      outstanding_q <= '0;
+    end else begin
+      unique case ({src_gnt, rsp_valid})
+        2'b10:   outstanding_q <= outstanding_q + 1'b1;
+        2'b01:   outstanding_q <= outstanding_q - 1'b1;
+        default: ;
+      endcase
+    end
+  end
+
+  cdc_fifo_gray #(
+      .T        (obi_req_t),
+      .LOG_DEPTH(LOG_DEPTH)
+  ) req_cdc_i (
+      .src_rst_ni,
+      .src_clk_i,
+      .src_data_i (src_req_i),
+      .src_valid_i(src_gnt),
+      .src_ready_o(req_ready),
+      .dst_rst_ni,
+      .dst_clk_i,
+      .dst_data_o (req_data),
+      .dst_valid_o(req_valid),
+      .dst_ready_i(dst_resp_i.gnt)
+  );
+
+  //Destination side
+  always_comb begin
+    dst_req_o     = req_data;
+    dst_req_o.req = req_valid;
+  end
+
+  cdc_fifo_gray #(
+      .T        (logic [31:0]),
+      .LOG_DEPTH(LOG_DEPTH)
+  ) rsp_cdc_i (
+      .src_rst_ni (dst_rst_ni),
+      .src_clk_i  (dst_clk_i),
+      .src_data_i (dst_resp_i.rdata),
+      .src_valid_i(dst_resp_i.rvalid),
+      .src_ready_o(),
+      .dst_rst_ni (src_rst_ni),
+      .dst_clk_i  (src_clk_i),
+      .dst_data_o (rsp_rdata),
+      .dst_valid_o(rsp_valid),
+      .dst_ready_i(1'b1)
+  );
+
+endmodule
@@ -3,14 +3,20 @@
 // SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
 // Luis Waucquez (luis.waucquez.jimenez@upm.es)
 
+// Chain of NDELAY obi_sngreg, the request is taken after delay_i stages
+// (1..NDELAY). The stages after the tap are kept empty.
+
 module obi_pipelined_delay #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NDELAY = 2
+    parameter NDELAY = 2,
+    // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
+    parameter int unsigned DelayWidth = $clog2(NDELAY + 1)
 ) (
     input logic clk_i,
     input logic rst_ni,
     input logic clear_pipeline,
+    input logic [DelayWidth-1:0] delay_i,
 
     input obi_req_t core_instr_req_i,
     output obi_req_t core_instr_req_o,
@@ -18,41 +24,40 @@ module obi_pipelined_delay #(
     output logic core_instr_resp_gnt_o
 );
 
-  obi_req_t [NDELAY-2:0] core_instr_req_s;
-  logic     [NDELAY-2:0] core_instr_resp_gnt_s;
-
-  for (genvar i = 0; i < NDELAY; i++) begin
-    if (i == 0) begin
-      obi_sngreg obi_sngreg_i (
-          .clk_i,
-          .rst_ni,
-          .clear_pipeline,
-          .core_instr_req_i(core_instr_req_i),
-          .core_instr_req_o(core_instr_req_s[i]),
-          .core_instr_resp_gnt_i(core_instr_resp_gnt_s[i]),
-          .core_instr_resp_gnt_o(core_instr_resp_gnt_o)
-      );
-    end else if (i == NDELAY - 1) begin
-      obi_sngreg obi_sngreg_i (
-          .clk_i,
-          .rst_ni,
-          .clear_pipeline,
-          .core_instr_req_i(core_instr_req_s[i-1]),
-          .core_instr_req_o(core_instr_req_o),
-          .core_instr_resp_gnt_i(core_instr_resp_gnt_i),
-          .core_instr_resp_gnt_o(core_instr_resp_gnt_s[i-1])
-      );
-    end else begin
-      obi_sngreg obi_sngreg_i (
-          .clk_i,
-          .rst_ni,
-          .clear_pipeline,
-          .core_instr_req_i(core_instr_req_s[i-1]),
-          .core_instr_req_o(core_instr_req_s[i]),
-          .core_instr_resp_gnt_i(core_instr_resp_gnt_s[i]),
-          .core_instr_resp_gnt_o(core_instr_resp_gnt_s[i-1])
-      );
+  obi_req_t [NDELAY-1:0] core_instr_req_s;
+  logic     [NDELAY-1:0] core_instr_resp_gnt_s;
+
+  for (genvar i = 0; i < NDELAY; i++) begin : gen_stage
+    obi_req_t stage_req;
+    logic stage_gnt;
+
+    if (i == 0) begin : gen_first_in
+      assign stage_req = core_instr_req_i;
+    end else begin : gen_rest_in
+      assign stage_req = core_instr_req_s[i-1];
     end
+
+    if (i == NDELAY - 1) begin : gen_last
+      assign stage_gnt = core_instr_resp_gnt_i;
+    end else begin : gen_mid
+      assign stage_gnt = (i == delay_i - 1) ? core_instr_resp_gnt_i : core_instr_resp_gnt_s[i+1];
+    end
+
+    obi_sngreg #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t)
+    ) obi_sngreg_i (
+        .clk_i,
+        .rst_ni,
+        .clear_pipeline(clear_pipeline || (i >= delay_i)),
+        .core_instr_req_i(stage_req),
+        .core_instr_req_o(core_instr_req_s[i]),
+        .core_instr_resp_gnt_i(stage_gnt),
+        .core_instr_resp_gnt_o(core_instr_resp_gnt_s[i])
+    );
   end
 
+  assign core_instr_req_o = core_instr_req_s[delay_i-1];
+  assign core_instr_resp_gnt_o = core_instr_resp_gnt_s[0];
+
 endmodule
@@ -14,7 +14,14 @@ module periph_system
     input logic rst_ni,
 
     input  obi_req_t  slave_req_i,
-    output obi_resp_t slave_resp_o
+    output obi_resp_t slave_resp_o,
+
+    //DMA Master
+    output obi_req_t  dma_master_req_o,
+    input  obi_resp_t dma_master_resp_i,
+
+    output logic dma_intr_o,
+    output logic dma_start_o
 );
 
 
@@ -83,4 +90,20 @@ module periph_system
       .reg_req_i(peripheral_slv_req[sap_pkg::DEBUG_BOOTROM_IDX]),
       .reg_rsp_o(peripheral_slv_rsp[sap_pkg::DEBUG_BOOTROM_IDX])
   );
+
+  sap_dma #(
+      .reg_req_t (reg_pkg::reg_req_t),
+      .reg_rsp_t (reg_pkg::reg_rsp_t),
+      .obi_req_t (obi_req_t),
+      .obi_resp_t(obi_resp_t)
+  ) sap_dma_i (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i(peripheral_slv_req[sap_pkg::DMA_IDX]),
+      .reg_rsp_o(peripheral_slv_rsp[sap_pkg::DMA_IDX]),
+      .dma_master_req_o,
+      .dma_master_resp_i,
+      .dma_intr_o,
+      .dma_start_o
+  );
 endmodule
@@ -39,6 +39,13 @@ module safe_FSM #(
     output logic Start_Boot_o,
     input logic End_sw_routine_i,
     output logic DMR_Rec_o,
+    input logic Dmr_tiebreak_en_i,
+    input logic Tiebreak_done_i,
+    output logic Tiebreak_o,
+    input logic Fast_Sync_i,
+    output logic Sync_Track_o,
+    output logic Sync_Clear_o,
+    output logic Sync_Busy_o,
     output logic en_ext_debug_req_o
 );
   // FSM state encoding
@@ -89,7 +96,8 @@ module safe_FSM #(
     DMR_TO_SINGLE,
     DMR_STOP,
     DMR_INTC_RECOVERY,
-    DMR_RECOVERY
+    DMR_RECOVERY,
+    DMR_TIEBREAK
   } ctrl_dmr_fsm_e;
 
   ctrl_safe_fsm_e ctrl_safe_fsm_cs, ctrl_safe_fsm_ns;
@@ -134,10 +142,15 @@ module safe_FSM #(
   logic dmr_error_s;
   logic [NHARTS-1:0] dmr_delayed_s;
   logic [NHARTS-1:0] DMR_Rec_s;
+  logic [NHARTS-1:0] Tiebreak_s;
 
   logic [1:0] tmr_error_ff;
   logic tmr_error_s;
 
+  //Fast sync: harts already in WAIT_SH
+  logic [NHARTS-1:0] tmr_wait_sh_s;
+  logic [NHARTS-1:0] dmr_wait_sh_s;
+
 
 
   always_ff @(posedge clk_i or negedge rst_ni) begin
@@ -373,7 +386,7 @@ module safe_FSM #(
           else if (ctrl_safe_fsm_cs == TMR_MODE && Start_i == 1'b1 && Enable_Switch_s == 1'b1) begin
             if (Master_Core_i[i] == 1'b1 && Hart_wfi_i[i] == 1'b1 && Initial_Sync_Master_i == 1'b1 && Start_i == 1'b1)
               ctrl_tmr_fsm_ns[i] = TMR_SH_HALT;
-            else if (Master_Core_i[i] == 1'b0 && (halt_req_s) == 1'b1 && Start_i == 1'b1)
+            else if (Master_Core_i[i] == 1'b0 && (halt_req_s || Fast_Sync_i) == 1'b1 && Start_i == 1'b1)
               ctrl_tmr_fsm_ns[i] = TMR_SH_HALT;
             else ctrl_tmr_fsm_ns[i] = TMR_IDLE;
           end else begin
@@ -392,16 +405,18 @@ module safe_FSM #(
         end
 
         TMR_SH_HALT: begin
-          if (Master_Core_i[i] == 1'b1 && ((Halt_ack_i[0] && Halt_ack_i[1]) || (Halt_ack_i[1] && Halt_ack_i[2]) 
+          if (Master_Core_i[i] == 1'b1 && Fast_Sync_i == 1'b0 && ((Halt_ack_i[0] && Halt_ack_i[1]) || (Halt_ack_i[1] && Halt_ack_i[2]) 
                 || (Halt_ack_i[0] && Halt_ack_i[2])) == 1'b1)
             ctrl_tmr_fsm_ns[i] = TMR_WAIT_SH;
+          else if (Master_Core_i[i] == 1'b1 && Fast_Sync_i == 1'b1 && (&(tmr_wait_sh_s | Master_Core_i)) == 1'b1)
+            ctrl_tmr_fsm_ns[i] = TMR_WAIT_SH;  //Slaves already halted, restoring or waiting
           else if (Master_Core_i[i] == 1'b0 && Halt_ack_i[i] == 1'b1)
             ctrl_tmr_fsm_ns[i] = TMR_WAIT_SH;
           else ctrl_tmr_fsm_ns[i] = TMR_SH_HALT;
         end
 
         TMR_WAIT_SH: begin
-          if (Hart_wfi_i[0] == 1'b1 && Hart_wfi_i[1] == 1'b1 && Hart_wfi_i[2] == 1'b1)
+          if (Hart_wfi_i[0] == 1'b1 && Hart_wfi_i[1] == 1'b1 && Hart_wfi_i[2] == 1'b1 && (!Fast_Sync_i || (&tmr_wait_sh_s)))
             ctrl_tmr_fsm_ns[i] = TMR_MS_INTRSYNC;
           else ctrl_tmr_fsm_ns[i] = TMR_WAIT_SH;
         end
@@ -480,7 +495,7 @@ module safe_FSM #(
           //Temporal solution TMR lecture from both slaves: Todo solve irregular response from de OBI BUS
           //when 2 different masters ask for gnt
           single_bus_s[i] = 1'b1;
-          tmr_voter_enable_s[i] = 1'b1;
+          tmr_voter_enable_s[i] = !Fast_Sync_i;  //Fast sync: every hart on its own bus
           if (Master_Core_i[i] == 1'b1) begin
             dbg_halt_req_s[i] = 1'b1;
             dbg_halt_req_general_s[i] = 1'b0;
@@ -490,8 +505,9 @@ module safe_FSM #(
         //Temporal solution: Todo solve irregular response from de OBI BUS
         //when 2 different masters ask for gnt
         TMR_WAIT_SH: begin
+          Switch_SingletoTMR_s[i] = Fast_Sync_i;
           single_bus_s[i] = 1'b1;
-          tmr_voter_enable_s[i] = 1'b1;
+          tmr_voter_enable_s[i] = !Fast_Sync_i;
         end
 
         TMR_MS_INTRSYNC: begin
@@ -569,7 +585,7 @@ module safe_FSM #(
           else if (ctrl_safe_fsm_cs == DMR_MODE && Start_i == 1'b1 && Enable_Switch_s == 1'b1 && DMR_Mask_i[i] == 1'b1) begin
             if (Master_Core_i[i] == 1'b1 && Hart_wfi_i[i] == 1'b1 && Initial_Sync_Master_i == 1'b1 && Start_i == 1'b1)
               ctrl_dmr_fsm_ns[i] = DMR_SH_HALT;
-            else if (Master_Core_i[i] == 1'b0 && (halt_req_s) == 1'b1 && Start_i == 1'b1)
+            else if (Master_Core_i[i] == 1'b0 && (halt_req_s || Fast_Sync_i) == 1'b1 && Start_i == 1'b1)
               ctrl_dmr_fsm_ns[i] = DMR_SH_HALT;
             else ctrl_dmr_fsm_ns[i] = DMR_IDLE;
           end else begin
@@ -588,7 +604,9 @@ module safe_FSM #(
         end
 
         DMR_SH_HALT: begin
-          if (Master_Core_i[i] == 1'b1 && (Halt_ack_i == (DMR_Mask_i ^ Master_Core_i)))
+          if (Master_Core_i[i] == 1'b1 && Fast_Sync_i == 1'b0 && (Halt_ack_i == (DMR_Mask_i ^ Master_Core_i)))
+            ctrl_dmr_fsm_ns[i] = DMR_WAIT_SH;
+          else if (Master_Core_i[i] == 1'b1 && Fast_Sync_i == 1'b1 && (&(dmr_wait_sh_s | Master_Core_i | ~DMR_Mask_i)) == 1'b1)
             ctrl_dmr_fsm_ns[i] = DMR_WAIT_SH;
           else if (Master_Core_i[i] == 1'b0 && Halt_ack_i[i] == 1'b1)
             ctrl_dmr_fsm_ns[i] = DMR_WAIT_SH;
@@ -596,7 +614,7 @@ module safe_FSM #(
         end
 
         DMR_WAIT_SH: begin
-          if (Hart_wfi_i[0] == 1'b1 && Hart_wfi_i[1] == 1'b1 && Hart_wfi_i[2] == 1'b1)
+          if (Hart_wfi_i[0] == 1'b1 && Hart_wfi_i[1] == 1'b1 && Hart_wfi_i[2] == 1'b1 && (!Fast_Sync_i || (&(dmr_wait_sh_s | ~DMR_Mask_i))))
             ctrl_dmr_fsm_ns[i] = DMR_MS_INTRSYNC;
           else ctrl_dmr_fsm_ns[i] = DMR_WAIT_SH;
         end
@@ -616,9 +634,15 @@ module safe_FSM #(
         end
 
         DMR_STOP: begin
-          if (Hart_wfi_i == 3'b111) ctrl_dmr_fsm_ns[i] = DMR_INTC_RECOVERY;
+          if (Hart_wfi_i == 3'b111 && Dmr_tiebreak_en_i == 1'b1) ctrl_dmr_fsm_ns[i] = DMR_TIEBREAK;
+          else if (Hart_wfi_i == 3'b111) ctrl_dmr_fsm_ns[i] = DMR_INTC_RECOVERY;
           else ctrl_dmr_fsm_ns[i] = DMR_STOP;
         end
+        //Third hart replay (dmr_tiebreak), then the rollback loads the checkpoint in place
+        DMR_TIEBREAK: begin
+          if (Tiebreak_done_i == 1'b1) ctrl_dmr_fsm_ns[i] = DMR_INTC_RECOVERY;
+          else ctrl_dmr_fsm_ns[i] = DMR_TIEBREAK;
+        end
         DMR_INTC_RECOVERY: begin
           if (Halt_ack_i[i] == 1'b1) ctrl_dmr_fsm_ns[i] = DMR_RECOVERY;
           else ctrl_dmr_fsm_ns[i] = DMR_INTC_RECOVERY;
@@ -658,6 +682,7 @@ module safe_FSM #(
       dbg_halt_dmr_recovery[i] = 1'b0;
       dmr_delayed_s[i] = 1'b0;
       DMR_Rec_s[i] = 1'b0;
+      Tiebreak_s[i] = 1'b0;
       unique case (ctrl_dmr_fsm_cs[i])
 
         DMR_IDLE: begin
@@ -691,6 +716,10 @@ module safe_FSM #(
           end else DMR_dbg_halt_req_general_s[i] = 1'b1;
         end
 
+        DMR_WAIT_SH: begin
+          Switch_SingletoDMR_s[i] = Fast_Sync_i;
+        end
+
         DMR_MS_INTRSYNC: begin
           Interrupt_Sync_DMR_s[i] = 1'b1;
           DMR_Single_s[i] = 1'b1;
@@ -719,6 +748,13 @@ module safe_FSM #(
           wfi_dmr_o[i] = 1'b1;
         end
 
+        DMR_TIEBREAK: begin
+          dual_mode_dmr_s[i] = 1'b1;
+          DMR_Single_s[i] = 1'b1;
+          wfi_dmr_o[i] = 1'b1;
+          Tiebreak_s[i] = 1'b1;
+        end
+
         DMR_INTC_RECOVERY: begin
           dual_mode_dmr_s[i] = 1'b1;
           DMR_Single_s[i] = 1'b1;
@@ -743,6 +779,28 @@ module safe_FSM #(
 
 
   // Inter-FSM Signals operation
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_wait_sh
+    assign tmr_wait_sh_s[i] = (ctrl_tmr_fsm_cs[i] == TMR_WAIT_SH);
+    assign dmr_wait_sh_s[i] = (ctrl_dmr_fsm_cs[i] == DMR_WAIT_SH);
+  end
+
+  //Fast sync: the slaves are halted with the switch request and restore while the master
+  //stores its context, sync_track holds each load until the master wrote that word
+  always_comb begin
+    Sync_Track_o = 1'b0;
+    Sync_Busy_o  = Enable_Switch_s;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (ctrl_tmr_fsm_cs[i] == TMR_SH_HALT || ctrl_tmr_fsm_cs[i] == TMR_WAIT_SH ||
+          ctrl_dmr_fsm_cs[i] == DMR_SH_HALT || ctrl_dmr_fsm_cs[i] == DMR_WAIT_SH) begin
+        Sync_Track_o = Fast_Sync_i;
+        Sync_Busy_o  = 1'b1;
+      end
+      if (ctrl_tmr_fsm_cs[i] == TMR_MS_INTRSYNC || ctrl_dmr_fsm_cs[i] == DMR_MS_INTRSYNC) Sync_Busy_o = 1'b1;
+    end
+  end
+
+  assign Sync_Clear_o = (ctrl_safe_fsm_cs != TMR_MODE) && (ctrl_safe_fsm_cs != DMR_MODE);
+
   assign halt_req_s = dbg_halt_req_s[0] || dbg_halt_req_s[1] || dbg_halt_req_s[2] ||
                     DMR_dbg_halt_req_s[0] || DMR_dbg_halt_req_s[1] || DMR_dbg_halt_req_s[2];
 
@@ -789,6 +847,7 @@ module safe_FSM #(
 
   assign Dmr_config_o = dmr_dmr_config_s;
   assign DMR_Rec_o = DMR_Rec_s[0] | DMR_Rec_s[1] | DMR_Rec_s[2];
+  assign Tiebreak_o = Tiebreak_s[0] | Tiebreak_s[1] | Tiebreak_s[2];
 
   assign Interrupt_swResync_o = Interrupt_sw_TMR_Resync_s;
 
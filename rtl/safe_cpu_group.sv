@@ -0,0 +1,1370 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// One redundancy group: three harts with their safe_FSM, voter, comparators
+// and safe_wrapper_ctrl block. safe_cpu_wrapper instantiates one per group.
+// The group is written for a triple (voters, muxes, masks and safe_FSM), so
+// NHARTS must be 3.
+
+module safe_cpu_group
+  import reg_pkg::*;
+  import sap_pkg::*;
+#(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter NHARTS  = sap_pkg::HARTS_PER_GROUP,
+    parameter NCYCLES = sap_pkg::NCYCLES
+) (
+    // Clock and Reset
+    input logic clk_i,
+    input logic rst_ni,
+
+    // Instruction memory interface
+    output obi_req_t  [NHARTS-1 : 0] core_instr_req_o,
+    input  obi_resp_t [NHARTS-1 : 0] core_instr_resp_i,
+
+    // Data memory interface
+    output obi_req_t  [NHARTS-1 : 0] core_data_req_o,
+    input  obi_resp_t [NHARTS-1 : 0] core_data_resp_i,
+
+    // OBI -> Memory mapped register control Safe CPU
+    input  reg_req_t wrapper_csr_req_i,
+    output reg_rsp_t wrapper_csr_resp_o,
+
+    // Debug Interface
+    input  logic              debug_req_i,
+    output logic [NHARTS-1:0] sleep_o,
+
+    //DMA Interrupt
+    input logic [NHARTS-1:0] dma_intr_i,  //per hart, set on the hart port that started the job
+
+    // System xbar QoS
+    output sap_pkg::xbar_qos_t xbar_qos_o,
+
+    // RAM ECC scrubber and error counts
+    output logic mem_scrub_en_o,
+    input logic [7:0] ecc_corrected_i,
+    input logic [7:0] ecc_uncorrected_i,
+
+    //External Interrupt
+    output logic interrupt_o
+);
+  //TODO: Future template 2 or 3 HARTS
+  localparam NRCOMPARATORS = NHARTS == 3 ? 3 : 1;
+  localparam int unsigned DelayWidth = $clog2(NCYCLES + 1);
+
+  //Assertions
+  if (NHARTS != 3) begin : gen_nharts_error
+    $error("safe_cpu_group: only groups of 3 harts are supported");
+  end
+
+  //Signals//
+
+  logic bus_config_s;
+
+  logic [NHARTS-1:0][31:0] intr;
+  logic [NHARTS-1:0][31:0] delayed_intr_i;
+  logic [NHARTS-1:0][31:0] delayed_intr_o;
+  logic [NHARTS-1:0][31:0] core_intr_i;
+  logic [NHARTS-1:0] ext_intr_s;
+
+  logic [NHARTS-1:0] debug_req;
+  logic [NHARTS-1:0] delayed_debug_req_i;
+  logic [NHARTS-1:0] delayed_debug_req_o;
+  logic [NHARTS-1:0] core_debug_req_i;
+
+  logic en_ext_debug_s;
+  logic Initial_Sync_Master_s;
+  logic [NHARTS-1:0] Hart_ack_s;
+  logic [NHARTS-1:0] Hart_wfi_s;
+  logic [NHARTS-1:0] Hart_intc_ack_s;
+  logic [NHARTS-1:0] Interrupt_swResync_s;
+  logic [NHARTS-1:0] Interrupt_DMSH_Sync_s;
+  logic [NHARTS-1:0] master_core_s;
+  logic [NHARTS-1:0] master_core_ff_s;
+  logic [2:0] safe_mode_s;
+  logic [1:0] safe_configuration_s;
+  logic critical_section_s;
+  logic [NHARTS-1:0] intc_sync_s;
+  logic [NHARTS-1:0] intc_halt_s;
+  logic [NHARTS-1:0] sleep_s;
+  logic [NHARTS-1:0] sleep_ff_s;
+  logic [NHARTS-1:0] debug_mode_s;
+  logic End_sw_routine_s;
+  logic Start_s;
+  logic Start_Boot_s;
+  logic DMR_Rec_s;
+  logic DMR_Rec_fsm_s;
+
+  // CPU ports
+  obi_req_t [NHARTS-1 : 0] core_instr_req;
+  obi_resp_t [NHARTS-1 : 0] core_instr_resp;
+
+  obi_req_t [NHARTS-1 : 0] core_data_req;
+  obi_resp_t [NHARTS-1 : 0] core_data_resp;
+
+  // Muxed Input CPU ports
+  obi_req_t [NHARTS-1 : 0] mux_core_data_req_i;
+
+  // Muxed Output CPU ports
+  obi_resp_t [NHARTS-1 : 0] mux_core_data_resp_o;
+
+  // XBAR_CPU Slaves Signals
+  obi_req_t [NHARTS-1 : 0][1:0] xbar_core_data_req;
+  obi_resp_t [NHARTS-1 : 0][1:0] xbar_core_data_resp;
+
+  // Voted_CPU Signals
+  obi_req_t [NHARTS-1 : 0] voted_core_instr_req_o;
+  obi_req_t [NHARTS-1 : 0] voted_core_data_req_o;
+  logic [NHARTS-1:0] voted_core_instr_gnt;
+  logic [NHARTS-1:0] voted_core_data_gnt;
+  logic [NHARTS-1:0] tmr_error_s;
+  logic [2:0] dmr_error_s;
+  logic [NHARTS-1:0][2:0] tmr_errorid_s;
+  logic [NHARTS-1:0][NHARTS-1:0][4:0] tmr_field_s;
+  logic [NHARTS-1:0][31:0] tmr_addr_s;
+  logic tmr_voter_enable_s;
+  logic tmr_voter_enable_fsm_s;
+  logic [2:0] dmr_config_s;
+  logic dual_mode_s;
+  logic dual_mode_fsm_s;
+  logic delayed_s;
+  logic delayed_fsm_s;
+  logic loose_s;
+  logic [3:0] lockstep_delay_s;
+  logic [DelayWidth-1:0] delay_cfg_s;
+  logic [DelayWidth-1:0] delay_sel_s;
+  logic [23:0] lockstep_interval_s;
+  logic [NHARTS-1:0] dmr_wfi_s;
+  logic [NHARTS-1:0] dmr_wfi_fsm_s;
+
+  // DCLS tie-break Signals
+  logic dmr_tiebreak_en_s;
+  logic tiebreak_start_s;
+  logic tiebreak_done_s;
+  logic tiebreak_live_s;
+  logic tiebreak_resolved_s;
+  logic tiebreak_rec_s;
+  logic [NHARTS-1:0] tiebreak_faulty_s;
+  logic [NHARTS-1:0] tb_hart_s;
+  logic [NHARTS-1:0] tb_halt_s;
+  logic [NHARTS-1:0] tb_hold_s;
+  logic [NHARTS-1:0] tb_irq_s;
+  logic [NHARTS-1:0] tb_isolate_s;
+
+  // Instruction ports before the line buffer
+  obi_req_t [NHARTS-1 : 0] port_instr_req;
+  obi_resp_t [NHARTS-1 : 0] port_instr_resp;
+
+  // Compared CPU Signals
+  obi_req_t [NRCOMPARATORS-1:0] compared_core_instr_req_o;
+  obi_req_t [NRCOMPARATORS-1:0] compared_core_data_req_o;
+  logic [NRCOMPARATORS-1:0] compared_core_instr_gnt;
+  logic [NRCOMPARATORS-1:0] compared_core_data_gnt;
+
+  // Port responses with the grant of the voter/comparator stage
+  obi_resp_t [NHARTS-1 : 0] stage_instr_resp;
+  obi_resp_t [NHARTS-1 : 0] stage_data_resp;
+
+  // Loose lockstep Signals
+  obi_req_t [NRCOMPARATORS-1:0] loose_core_instr_req_o;
+  obi_req_t [NRCOMPARATORS-1:0] loose_core_data_req_o;
+  logic [NRCOMPARATORS-1:0] loose_error_s;
+  logic [NRCOMPARATORS-1:0][31:0] loose_intr_s;
+  logic [NRCOMPARATORS-1:0] loose_debug_req_s;
+  logic [NRCOMPARATORS-1:0] cmp_error_s;
+  logic [NRCOMPARATORS-1:0] cmp_data_error_s;
+  logic [NRCOMPARATORS-1:0][4:0] cmp_field_s;
+  logic [NRCOMPARATORS-1:0][31:0] cmp_addr_s;
+
+  // TCLS master failover
+  logic tmr_failover_en_s;
+  logic failover_hold_q;
+  logic tmr_on_q, tmr_exit_q;
+  logic tmr_exit_s, tmr_busy_s, tmr_stage_busy_s;
+  logic failover_instr_gate_s, failover_data_gate_s;
+  logic failover_s;
+  logic [NHARTS-1:0] failover_master_q;
+  logic [NHARTS-1:0] failover_faulty_q;
+
+  // Fast sync
+  logic fast_sync_s;
+  logic sync_track_s;
+  logic sync_clear_s;
+  logic sync_busy_s;
+  logic [31:0] safe_copy_addr_s;
+  logic [NHARTS-1:0] sync_hold_s;
+
+  // Relaxed checking
+  logic check_stores_s;
+  logic check_sample_s;
+  logic [7:0] check_nth_s;
+  logic check_instr_acc_s, check_data_acc_s;
+  logic instr_check_s, data_check_s, load_check_s;
+
+  // Mismatch telemetry
+  logic mismatch_s;
+  logic [NHARTS-1:0][4:0] mismatch_field_s;
+  logic [31:0] mismatch_addr_s;
+
+  // CPU Private Regs
+  reg_pkg::reg_req_t [NHARTS-1 : 0] cpu_reg_req;
+  reg_pkg::reg_rsp_t [NHARTS-1 : 0] cpu_reg_rsp;
+
+  // Safe CPU reg port
+  reg_pkg::reg_req_t safe_cpu_wrapper_reg_req;
+  reg_pkg::reg_rsp_t safe_cpu_wrapper_reg_rsp;
+
+
+  // Configuration IDs Cores
+
+  logic [2:0][NHARTS-1:0] Core_ID;
+  assign Core_ID[0] = {3'b001};
+  assign Core_ID[1] = {3'b010};
+  assign Core_ID[2] = {3'b100};
+
+  //Isolate val bus
+  // Instruction memory interface
+  obi_resp_t [NHARTS-1 : 0] isolate_core_instr_resp;
+
+  // Data memory interface
+  obi_resp_t [NHARTS-1 : 0] isolate_core_data_resp;
+
+
+  //***Cores System***//
+
+  cpu_system #(
+      .obi_req_t            (obi_req_t  ),
+      .obi_resp_t           (obi_resp_t )
+      ) cpu_system_i (
+      .clk_i,
+      .rst_ni,
+      // Instruction memory interface
+      .core_instr_req_o (core_instr_req),
+      .core_instr_resp_i(core_instr_resp),
+
+      // Data memory interface
+      .core_data_req_o (core_data_req),
+      .core_data_resp_i(core_data_resp),
+
+      // Interrupt
+      //Core 0
+      .intc_core0(core_intr_i[0]),
+      //Core 1
+      .intc_core1(core_intr_i[1]),
+
+      //Core 2
+      .intc_core2(core_intr_i[2]),
+
+
+      .sleep_o(sleep_s),
+
+      // Debug Interface
+      .debug_req_i (core_debug_req_i),
+      .debug_mode_o(debug_mode_s)
+  );
+
+  assign sleep_o = sleep_ff_s;
+
+  //Added FF for output isolation
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      sleep_ff_s <= '0;
+    end else begin
+      sleep_ff_s <= sleep_s;
+    end
+  end
+
+  safe_wrapper_ctrl #(
+      .reg_req_t(reg_pkg::reg_req_t),
+      .reg_rsp_t(reg_pkg::reg_rsp_t)
+  ) safe_wrapper_ctrl_i (
+      .clk_i,
+      .rst_ni,
+
+      // Bus Interface
+      .reg_req_i(wrapper_csr_req_i),
+      .reg_rsp_o(wrapper_csr_resp_o),
+
+      .master_core_o(master_core_s),
+      .safe_mode_o(safe_mode_s),
+      .safe_configuration_o(safe_configuration_s),
+      .critical_section_o(critical_section_s),
+      .Initial_Sync_Master_o(Initial_Sync_Master_s),
+      .Start_o(Start_s),
+      .End_sw_routine_o(End_sw_routine_s),
+      .xbar_qos_o,
+      .mem_scrub_en_o,
+      .ecc_corrected_i,
+      .ecc_uncorrected_i,
+      .lockstep_loose_o(loose_s),
+      .lockstep_delay_o(lockstep_delay_s),
+      .lockstep_interval_o(lockstep_interval_s),
+      .dmr_tiebreak_en_o(dmr_tiebreak_en_s),
+      .tiebreak_live_i(tiebreak_live_s),
+      .tiebreak_done_i(tiebreak_done_s),
+      .tiebreak_resolved_i(tiebreak_resolved_s),
+      .tiebreak_faulty_i(tiebreak_faulty_s),
+      .tmr_failover_en_o(tmr_failover_en_s),
+      .failover_i(failover_s),
+      .failover_master_i(failover_master_q),
+      .failover_faulty_i(failover_faulty_q),
+      .fast_sync_o(fast_sync_s),
+      .safe_copy_addr_o(safe_copy_addr_s),
+      .sync_busy_i(sync_busy_s),
+      .check_stores_o(check_stores_s),
+      .check_sample_o(check_sample_s),
+      .check_nth_o(check_nth_s),
+      .mismatch_i(mismatch_s),
+      .mismatch_field_i(mismatch_field_s),
+      .mismatch_addr_i(mismatch_addr_s),
+      .interrupt_o(interrupt_o),
+      .debug_mode_i(debug_mode_s),
+      .sleep_i(sleep_s),
+      .Start_Boot_i(Start_Boot_s),
+      .DMR_Rec_i(DMR_Rec_s),
+      //.Debug_ext_req_i(debug_req_i), //Check if debug_req comes from FSM or external debug Todo: change to 1 the extenal req
+      .en_ext_debug_i(en_ext_debug_s)  //Todo: other more elegant solution for debugging
+  );
+
+
+  //***Safe FSM***//
+
+  safe_FSM safe_FSM_i (
+      // Clock and Reset
+      .clk_i,
+      .rst_ni,
+      .tmr_critical_section_i(critical_section_s),
+      .DMR_Mask_i(safe_mode_s),
+      .Safe_configuration_i(safe_configuration_s),
+      .Initial_Sync_Master_i(Initial_Sync_Master_s),
+      .Halt_ack_i(debug_mode_s),
+      .Hart_wfi_i(sleep_s),
+      .Hart_intc_ack_i(Hart_intc_ack_s),
+      .Master_Core_i(master_core_s),
+      .Interrupt_Sync_o(intc_sync_s),
+      .Interrupt_swResync_o(Interrupt_swResync_s),
+      .Interrupt_Halt_o(intc_halt_s),
+      .tmr_error_i(tmr_error_s[0] | tmr_error_s[1] | tmr_error_s[2]),
+      .voter_id_error(tmr_errorid_s[0] | tmr_errorid_s[1] | tmr_errorid_s[2]),
+      .Single_Bus_o(bus_config_s),
+      .Tmr_voter_enable_o(tmr_voter_enable_fsm_s),
+      .Dmr_comparator_enable_o(dual_mode_fsm_s),
+      .Dmr_config_o(dmr_config_s),
+      .dmr_error_i(dmr_error_s),
+      .wfi_dmr_o(dmr_wfi_fsm_s),
+      .Delayed_o(delayed_fsm_s),
+      .Start_Boot_o(Start_Boot_s),
+      .Start_i(Start_s),
+      .End_sw_routine_i(End_sw_routine_s),
+      .DMR_Rec_o(DMR_Rec_fsm_s),
+      .Dmr_tiebreak_en_i(dmr_tiebreak_en_s),
+      .Tiebreak_done_i(tiebreak_done_s),
+      .Tiebreak_o(tiebreak_start_s),
+      .Fast_Sync_i(fast_sync_s),
+      .Sync_Track_o(sync_track_s),
+      .Sync_Clear_o(sync_clear_s),
+      .Sync_Busy_o(sync_busy_s),
+      .en_ext_debug_req_o(en_ext_debug_s)
+  );
+  //External interrupts
+  //A line owned by a member of the TCLS/DCLS set is delivered to the whole set
+  logic [NHARTS-1:0] irq_group_s;
+
+  assign irq_group_s = tmr_voter_enable_s ? '1 : dual_mode_s ? dmr_config_s & ~tb_hart_s : '0;
+
+  if (sap_pkg::IRQ_SYNC) begin : gen_irq_sync
+    logic [NHARTS-1:0] irq_fetch_s;
+
+    for (genvar i = 0; i < NHARTS; i++) begin : gen_fetch
+      assign irq_fetch_s[i] = core_instr_req[i].req && core_instr_resp[i].gnt;
+    end
+
+    irq_sync #(
+        .NHARTS(NHARTS),
+        .NIRQ  (1)
+    ) irq_sync_i (
+        .clk_i,
+        .rst_ni,
+        .irq_i(dma_intr_i),
+        .group_i(irq_group_s),
+        .master_i(master_core_ff_s),
+        .fetch_i(irq_fetch_s),
+        .sleep_i(sleep_s),
+        .irq_o(ext_intr_s)
+    );
+  end else begin : gen_no_irq_sync
+    for (genvar i = 0; i < NHARTS; i++) begin : gen_irq
+      assign ext_intr_s[i] = irq_group_s[i] ? |(dma_intr_i & irq_group_s) : dma_intr_i[i];
+    end
+  end
+
+  assign intr[0] = {10'b0, tb_irq_s[0], ext_intr_s[0], 1'b0, 1'b0, intc_sync_s[0], Interrupt_swResync_s[0], 16'b0};
+  assign intr[1] = {10'b0, tb_irq_s[1], ext_intr_s[1], 1'b0, 1'b0, intc_sync_s[1], Interrupt_swResync_s[1], 16'b0};
+  assign intr[2] = {10'b0, tb_irq_s[2], ext_intr_s[2], 1'b0, 1'b0, intc_sync_s[2], Interrupt_swResync_s[2], 16'b0};
+
+  //Todo: future posibility to debug during TMR_SYNC or DMR_SYNC
+  assign debug_req[0] = (debug_req_i && en_ext_debug_s && master_core_s[0]) || intc_halt_s[0] || tb_halt_s[0];
+  assign debug_req[1] = (debug_req_i && en_ext_debug_s && master_core_s[1]) || intc_halt_s[1] || tb_halt_s[1];
+  assign debug_req[2] = (debug_req_i && en_ext_debug_s && master_core_s[2]) || intc_halt_s[2] || tb_halt_s[2];
+
+  //The tie-break hart restores the checkpoint like a DMR recovery and is isolated if unresolved
+  assign DMR_Rec_s = DMR_Rec_fsm_s | tiebreak_rec_s;
+  assign dmr_wfi_s = dmr_wfi_fsm_s | tb_isolate_s;
+
+  /**************************Upper-Demux-Req**********************************/
+  //upper
+  obi_req_t [NHARTS-1:0][NHARTS-1:0] upper_mux_core_instr_req_i;
+  obi_req_t [NHARTS-1:0][NHARTS-1:0] upper_mux_core_data_req_i;
+
+  obi_resp_t [NHARTS-1:0][1:0] upper_delayed_core_instr_resp_i;
+  obi_resp_t [NHARTS-1:0][1:0] upper_delayed_core_data_resp_i;
+
+  //lower
+  obi_resp_t [NHARTS-1:0][1:0] lower_mux_core_instr_resp_i;
+  obi_resp_t [NHARTS-1:0][1:0] lower_mux_core_data_resp_i;
+
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_upper_demux
+    always_comb begin
+      if (tb_hart_s[i]) begin  // DCLS tie-break: the third hart uses its own bus
+        upper_mux_core_instr_req_i[i]    = '0;
+        upper_mux_core_instr_req_i[i][i] = core_instr_req[i];
+
+        upper_mux_core_data_req_i[i]     = '0;
+        upper_mux_core_data_req_i[i][i]  = mux_core_data_req_i[i];
+      end else if (master_core_ff_s[2] && (dual_mode_s || tmr_voter_enable_s)) begin
+        upper_mux_core_instr_req_i[i][0] = '0;
+        upper_mux_core_instr_req_i[i][1] = '0;
+        upper_mux_core_instr_req_i[i][2] = core_instr_req[i];
+
+        upper_mux_core_data_req_i[i][0]  = '0;
+        upper_mux_core_data_req_i[i][1]  = '0;
+        upper_mux_core_data_req_i[i][2]  = mux_core_data_req_i[i];
+      end else if (master_core_ff_s[1] && (dual_mode_s || tmr_voter_enable_s)) begin
+        upper_mux_core_instr_req_i[i][0] = '0;
+        upper_mux_core_instr_req_i[i][1] = core_instr_req[i];
+        upper_mux_core_instr_req_i[i][2] = '0;
+
+        upper_mux_core_data_req_i[i][0]  = '0;
+        upper_mux_core_data_req_i[i][1]  = mux_core_data_req_i[i];
+        upper_mux_core_data_req_i[i][2]  = '0;
+      end else if (master_core_ff_s[0] && (dual_mode_s || tmr_voter_enable_s)) begin
+        upper_mux_core_instr_req_i[i][0] = core_instr_req[i];
+        upper_mux_core_instr_req_i[i][1] = '0;
+        upper_mux_core_instr_req_i[i][2] = '0;
+
+        upper_mux_core_data_req_i[i][0]  = mux_core_data_req_i[i];
+        upper_mux_core_data_req_i[i][1]  = '0;
+        upper_mux_core_data_req_i[i][2]  = '0;
+      end else begin  // default case when not a master and the core has to use its bus
+        if (i == 0) begin
+          upper_mux_core_instr_req_i[i][0] = core_instr_req[i];
+          upper_mux_core_instr_req_i[i][1] = '0;
+          upper_mux_core_instr_req_i[i][2] = '0;
+
+          upper_mux_core_data_req_i[i][0]  = mux_core_data_req_i[i];
+          upper_mux_core_data_req_i[i][1]  = '0;
+          upper_mux_core_data_req_i[i][2]  = '0;
+        end else if (i == 1) begin
+          upper_mux_core_instr_req_i[i][0] = '0;
+          upper_mux_core_instr_req_i[i][1] = core_instr_req[i];
+          upper_mux_core_instr_req_i[i][2] = '0;
+
+          upper_mux_core_data_req_i[i][0]  = '0;
+          upper_mux_core_data_req_i[i][1]  = mux_core_data_req_i[i];
+          upper_mux_core_data_req_i[i][2]  = '0;
+        end else begin
+          upper_mux_core_instr_req_i[i][0] = '0;
+          upper_mux_core_instr_req_i[i][1] = '0;
+          upper_mux_core_instr_req_i[i][2] = core_instr_req[i];
+
+          upper_mux_core_data_req_i[i][0]  = '0;
+          upper_mux_core_data_req_i[i][1]  = '0;
+          upper_mux_core_data_req_i[i][2]  = mux_core_data_req_i[i];
+        end
+      end
+      //TCLS failover: nothing new reaches the voters once the master port is not
+      //presenting an ungranted request
+      for (int unsigned k = 0; k < NHARTS; k++) begin
+        if (failover_instr_gate_s) upper_mux_core_instr_req_i[i][k].req = 1'b0;
+        if (failover_data_gate_s) upper_mux_core_data_req_i[i][k].req = 1'b0;
+      end
+    end
+  end
+
+  /**************************************************************************/
+
+  /**************************Lower-Mux-Req**********************************/
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_lower_mux_obi_req
+
+    always_comb begin
+      //TODO: Reduce de mux configurations inputs ports, implies modification in the Safe_FSM
+      if (master_core_ff_s[i] && tmr_voter_enable_s && !dual_mode_s) begin
+        port_instr_req[i] = voted_core_instr_req_o[i];
+        core_data_req_o[i]  = voted_core_data_req_o[i];
+      end else if (master_core_ff_s[i] && !tmr_voter_enable_s && dual_mode_s && delayed_s && loose_s) begin
+        port_instr_req[i] = loose_core_instr_req_o[i];
+        core_data_req_o[i]  = loose_core_data_req_o[i];
+      end else if (master_core_ff_s[i] && !tmr_voter_enable_s && dual_mode_s) begin
+        port_instr_req[i] = compared_core_instr_req_o[i];
+        core_data_req_o[i]  = compared_core_data_req_o[i];
+      end else begin //Todo: Put here in the future the posibility to wake up the third core in case of a hang in DCLS mode.
+        port_instr_req[i] = upper_mux_core_instr_req_i[i][i];
+        core_data_req_o[i]  = upper_mux_core_data_req_i[i][i];
+        if (tb_hold_s[i]) core_data_req_o[i].req = 1'b0;  //Tie-break hart at the mismatched request
+        if (sync_hold_s[i]) core_data_req_o[i].req = 1'b0;  //Fast sync: context word not stored yet
+      end
+    end
+  end
+
+  /**************************************************************************/
+  /**************************Instruction-Buffer******************************/
+  //After the voter/comparator: in TMR only the master port fetches and its
+  //responses reach the three harts, in single mode every core has its own.
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_ibuf
+    if (sap_pkg::IBUF_ENABLE) begin : gen_ibuf_en
+      sap_ibuf #(
+          .obi_req_t (obi_req_t),
+          .obi_resp_t(obi_resp_t)
+      ) sap_ibuf_i (
+          .clk_i,
+          .rst_ni,
+          .flush_i(sleep_s[i] || (failover_s && failover_master_q[i])),
+          .inv_i(core_data_req_o[i].req && core_data_req_o[i].we && core_data_resp_i[i].gnt),
+          .inv_addr_i(core_data_req_o[i].addr),
+          .instr_req_i(port_instr_req[i]),
+          .instr_resp_o(port_instr_resp[i]),
+          .instr_req_o(core_instr_req_o[i]),
+          .instr_resp_i(core_instr_resp_i[i])
+      );
+    end else begin : gen_no_ibuf
+      assign core_instr_req_o[i] = port_instr_req[i];
+      assign port_instr_resp[i]  = core_instr_resp_i[i];
+    end
+  end
+
+  /**************************************************************************/
+  /**************************Lower-Demux-Resp********************************/
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_lower_mux_obi_resp
+    //Same selection as the Lower-Mux-Req: grant from the voter/comparator stage
+    always_comb begin
+      stage_instr_resp[i] = port_instr_resp[i];
+      stage_data_resp[i]  = core_data_resp_i[i];
+      if (master_core_ff_s[i] && tmr_voter_enable_s && !dual_mode_s) begin
+        stage_instr_resp[i].gnt = voted_core_instr_gnt[i] && !failover_instr_gate_s;
+        stage_data_resp[i].gnt  = voted_core_data_gnt[i] && !failover_data_gate_s;
+      end else if (master_core_ff_s[i] && !tmr_voter_enable_s && dual_mode_s && !(delayed_s && loose_s)) begin
+        stage_instr_resp[i].gnt = compared_core_instr_gnt[i];
+        stage_data_resp[i].gnt  = compared_core_data_gnt[i];
+      end else if (tb_hold_s[i] || sync_hold_s[i]) begin
+        stage_data_resp[i].gnt  = 1'b0;
+      end
+    end
+
+    always_comb begin
+      if (delayed_s & dual_mode_s & ~tb_hart_s[i]) begin  //TODO: should not be necesary use de dual_mode_s
+        lower_mux_core_instr_resp_i[i][0] = '0;
+        lower_mux_core_instr_resp_i[i][1] = stage_instr_resp[i];
+
+        lower_mux_core_data_resp_i[i][0]  = '0;
+        lower_mux_core_data_resp_i[i][1]  = stage_data_resp[i];
+      end else begin
+        lower_mux_core_instr_resp_i[i][0] = stage_instr_resp[i];
+        lower_mux_core_instr_resp_i[i][1] = '0;
+
+        lower_mux_core_data_resp_i[i][0]  = stage_data_resp[i];
+        lower_mux_core_data_resp_i[i][1]  = '0;
+      end
+    end
+  end
+
+  /*********************************************************************/
+  /**************************Upper-Mux-Resp********************************/
+  //upper_mux_core_instr_req_i;
+  //upper_mux_core_data_req_i;
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_upper_mux_obi_resp
+    always_comb begin
+      if (dmr_wfi_s[i] == '1) begin
+        core_instr_resp[i] = isolate_core_instr_resp[i];
+        mux_core_data_resp_o[i] = isolate_core_data_resp[i];
+      end else if (master_core_ff_s[0] && !delayed_s && (tmr_voter_enable_s || (dual_mode_s && dmr_config_s[i]))) begin
+        core_instr_resp[i] = lower_mux_core_instr_resp_i[0][0];
+        mux_core_data_resp_o[i] = lower_mux_core_data_resp_i[0][0];
+      end else if (master_core_ff_s[1] && !delayed_s && (tmr_voter_enable_s || (dual_mode_s && dmr_config_s[i]))) begin
+        core_instr_resp[i] = lower_mux_core_instr_resp_i[1][0];
+        mux_core_data_resp_o[i] = lower_mux_core_data_resp_i[1][0];
+      end else if (master_core_ff_s[2] && !delayed_s && (tmr_voter_enable_s || (dual_mode_s && dmr_config_s[i]))) begin
+        core_instr_resp[i] = lower_mux_core_instr_resp_i[2][0];
+        mux_core_data_resp_o[i] = lower_mux_core_data_resp_i[2][0];
+        //delayed
+      end else if (master_core_ff_s[i] && dual_mode_s && delayed_s) begin //if master of DCLS connect to the second core
+        core_instr_resp[i] = upper_delayed_core_instr_resp_i[i][0];
+        mux_core_data_resp_o[i] = upper_delayed_core_data_resp_i[i][0];
+      end else if (!master_core_ff_s[i] && dual_mode_s && delayed_s && dmr_config_s[i])  begin //if not master of DCLS connect to the second core
+        if (master_core_ff_s[0]) begin
+          core_instr_resp[i] = upper_delayed_core_instr_resp_i[0][1];
+          mux_core_data_resp_o[i] = upper_delayed_core_data_resp_i[0][1];
+        end else if (master_core_ff_s[1]) begin
+          core_instr_resp[i] = upper_delayed_core_instr_resp_i[1][1];
+          mux_core_data_resp_o[i] = upper_delayed_core_data_resp_i[1][1];
+        end else begin
+          core_instr_resp[i] = upper_delayed_core_instr_resp_i[2][1];
+          mux_core_data_resp_o[i] = upper_delayed_core_data_resp_i[2][1];
+        end
+        //default
+      end else begin
+        core_instr_resp[i] = lower_mux_core_instr_resp_i[i][0];
+        mux_core_data_resp_o[i] = lower_mux_core_data_resp_i[i][0];
+      end
+    end
+  end
+  /*********************************************************************/
+  /*********************************************************************/
+
+  assign mux_core_data_req_i[0] = xbar_core_data_req[0][0];
+  assign mux_core_data_req_i[1] = xbar_core_data_req[1][0];
+  assign mux_core_data_req_i[2] = xbar_core_data_req[2][0];
+  assign xbar_core_data_resp[0][0] = mux_core_data_resp_o[0];
+  assign xbar_core_data_resp[1][0] = mux_core_data_resp_o[1];
+  assign xbar_core_data_resp[2][0] = mux_core_data_resp_o[2];
+
+
+  /************************Isolate BUS***************************/
+  logic [NHARTS-1:0] instr_isolate_valid_q;
+  logic [NHARTS-1:0] instr_expected_rvalid;
+  for (genvar i = 0; i < NHARTS; i++) begin : isolate_obi_bus_instr
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        instr_isolate_valid_q[i] <= '0;
+        instr_expected_rvalid[i] <= '0;
+      end else begin
+        if (dmr_wfi_s[i] == 1'b0) begin  //clear
+          instr_isolate_valid_q[i] <= '0;
+          //if req & gnt before wfi halt, it needs a rvalid ack otherwise could stall waiting that read/write request.
+          instr_expected_rvalid[i] <= (core_instr_req[i].req & core_instr_resp[i].gnt) | (instr_expected_rvalid[i] & ~core_instr_resp[i].rvalid);
+        end else begin
+          instr_isolate_valid_q[i] <= isolate_core_instr_resp[i].gnt;
+          instr_expected_rvalid[i] <= '0;
+        end
+      end
+    end
+    assign isolate_core_instr_resp[i].gnt = core_instr_req[i].req;
+    assign isolate_core_instr_resp[i].rvalid = instr_isolate_valid_q[i] | instr_expected_rvalid[i];
+    assign isolate_core_instr_resp[i].rdata = 32'h10500073;  //wfi instruction
+  end
+
+  logic [NHARTS-1:0] data_isolate_valid_q;
+  logic [NHARTS-1:0] data_expected_rvalid;
+  for (genvar i = 0; i < NHARTS; i++) begin : isolate_obi_bus_data
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        data_isolate_valid_q[i] <= '0;
+        data_expected_rvalid[i] <= '0;
+      end else begin
+        if (dmr_wfi_s[i] == 1'b0) begin  //clear
+          data_isolate_valid_q[i] <= '0;
+          //if req & gnt before wfi halt, it needs a rvalid ack otherwise could stall waiting that read/write request.
+          data_expected_rvalid[i] <= core_data_req[i].req & mux_core_data_resp_o[i].gnt | (data_expected_rvalid[i] & ~mux_core_data_resp_o[i].rvalid);
+        end else begin
+          data_isolate_valid_q[i] <= isolate_core_data_resp[i].gnt;
+          data_expected_rvalid[i] <= '0;
+        end
+      end
+    end
+    assign isolate_core_data_resp[i].gnt = core_data_req[i].req;
+    assign isolate_core_data_resp[i].rvalid = data_isolate_valid_q[i] | data_expected_rvalid[i];
+    assign isolate_core_data_resp[i].rdata = 32'h0;  //0 data val
+  end
+
+
+  /*********************************************************/
+  //*********************Safety Voter***********************//
+  obi_req_t [NHARTS-1:0] tmr0_core_instr_req_i;
+  obi_req_t [NHARTS-1:0] tmr1_core_instr_req_i;
+  obi_req_t [NHARTS-1:0] tmr2_core_instr_req_i;
+  assign tmr0_core_instr_req_i = {
+    upper_mux_core_instr_req_i[2][0],
+    upper_mux_core_instr_req_i[1][0],
+    upper_mux_core_instr_req_i[0][0]
+  };
+  assign tmr1_core_instr_req_i = {
+    upper_mux_core_instr_req_i[2][1],
+    upper_mux_core_instr_req_i[1][1],
+    upper_mux_core_instr_req_i[0][1]
+  };
+  assign tmr2_core_instr_req_i = {
+    upper_mux_core_instr_req_i[2][2],
+    upper_mux_core_instr_req_i[1][2],
+    upper_mux_core_instr_req_i[0][2]
+  };
+
+  obi_req_t [NHARTS-1:0] tmr0_core_data_req_i;
+  obi_req_t [NHARTS-1:0] tmr1_core_data_req_i;
+  obi_req_t [NHARTS-1:0] tmr2_core_data_req_i;
+  assign tmr0_core_data_req_i = {
+    upper_mux_core_data_req_i[2][0],
+    upper_mux_core_data_req_i[1][0],
+    upper_mux_core_data_req_i[0][0]
+  };
+  assign tmr1_core_data_req_i = {
+    upper_mux_core_data_req_i[2][1],
+    upper_mux_core_data_req_i[1][1],
+    upper_mux_core_data_req_i[0][1]
+  };
+  assign tmr2_core_data_req_i = {
+    upper_mux_core_data_req_i[2][2],
+    upper_mux_core_data_req_i[1][2],
+    upper_mux_core_data_req_i[0][2]
+  };
+
+  //TODO: **Temporal** Gated outpout to avoid changing master until switch to single mode
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (~rst_ni) begin
+      master_core_ff_s <= 3'b001;  //default master
+    end else begin
+      if (failover_s) master_core_ff_s <= failover_master_q;
+      else if (sleep_s == 3'b111 && !tmr_exit_s) master_core_ff_s <= master_core_s;
+    end
+  end
+
+  //******************TCLS master failover********************//
+  //The master outvoted (Tmr_Failover.EN): the requests of the harts are held
+  //until the master port has nothing in flight, then the first healthy hart
+  //becomes master (and Master_core) without leaving TMR_MODE. A request the
+  //master port presents ungranted at the trigger finishes its handshake first
+  //(without VOTER_PIPELINE it comes straight from the voter inputs).
+  logic [NHARTS-1:0] failover_err_s;
+  logic [NHARTS-1:0] failover_next_s;
+  logic failover_trigger_s;
+  logic failover_idle_s;
+  logic [2:0] failover_instr_out_q, failover_data_out_q;
+  logic failover_instr_acc_s, failover_instr_ret_s;
+  logic failover_data_acc_s, failover_data_ret_s;
+  logic failover_voted_req_s;
+  logic failover_instr_pend_s, failover_data_pend_s;
+  logic failover_instr_drain_q, failover_data_drain_q;
+  logic failover_start_s;
+
+  assign failover_err_s = tmr_errorid_s[0] | tmr_errorid_s[1] | tmr_errorid_s[2];
+
+  always_comb begin
+    failover_next_s = '0;
+    for (int i = NHARTS - 1; i >= 0; i--) begin
+      if (!failover_err_s[i] && !master_core_ff_s[i]) failover_next_s = NHARTS'(1) << i;
+    end
+  end
+
+  assign failover_trigger_s = tmr_failover_en_s && tmr_voter_enable_s && !dual_mode_s && !failover_hold_q &&
+                              (|tmr_error_s) && (|(failover_err_s & master_core_ff_s)) && (|failover_next_s);
+
+  //Master port
+  always_comb begin
+    failover_instr_acc_s = 1'b0;
+    failover_instr_ret_s = 1'b0;
+    failover_data_acc_s  = 1'b0;
+    failover_data_ret_s  = 1'b0;
+    failover_voted_req_s = 1'b0;
+    failover_instr_pend_s = 1'b0;
+    failover_data_pend_s  = 1'b0;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (master_core_ff_s[i]) begin
+        failover_instr_acc_s = port_instr_req[i].req && port_instr_resp[i].gnt;
+        failover_instr_ret_s = port_instr_resp[i].rvalid;
+        failover_data_acc_s  = core_data_req_o[i].req && core_data_resp_i[i].gnt;
+        failover_data_ret_s  = core_data_resp_i[i].rvalid;
+        failover_voted_req_s = voted_core_instr_req_o[i].req || voted_core_data_req_o[i].req;
+        failover_instr_pend_s = port_instr_req[i].req && !port_instr_resp[i].gnt;
+        failover_data_pend_s  = core_data_req_o[i].req && !core_data_resp_i[i].gnt;
+      end
+    end
+  end
+
+  assign failover_idle_s = (failover_instr_out_q == '0) && (failover_data_out_q == '0) && !failover_voted_req_s;
+  assign failover_s = failover_hold_q && failover_idle_s;
+  assign failover_start_s = failover_trigger_s || (tmr_exit_s && !tmr_exit_q);
+  assign failover_instr_gate_s = (failover_hold_q || (tmr_exit_q && tmr_exit_s)) && !failover_instr_drain_q;
+  assign failover_data_gate_s  = (failover_hold_q || (tmr_exit_q && tmr_exit_s)) && !failover_data_drain_q;
+
+  //TMR exit: the voter (and the TMR muxes) stay enabled after safe_FSM leaves
+  //TMR_MODE until the master port has nothing in flight, so a request granted
+  //to the harts by the VOTER_PIPELINE stage is never flushed. New requests are
+  //held as in a failover. Without VOTER_PIPELINE the voted request comes from
+  //the harts, only the transactions in flight are waited for.
+  if (sap_pkg::VOTER_PIPELINE) begin : gen_tmr_stage_busy
+    assign tmr_stage_busy_s = failover_voted_req_s;
+  end else begin : gen_no_tmr_stage
+    assign tmr_stage_busy_s = 1'b0;
+  end
+
+  assign tmr_busy_s = (failover_instr_out_q != '0) || (failover_data_out_q != '0) || tmr_stage_busy_s;
+  assign tmr_exit_s = tmr_on_q && !tmr_voter_enable_fsm_s && tmr_busy_s;
+  assign tmr_voter_enable_s = tmr_voter_enable_fsm_s || tmr_exit_s;
+  assign dual_mode_s = dual_mode_fsm_s && !tmr_exit_s;
+  assign delayed_s = delayed_fsm_s && !tmr_exit_s;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (~rst_ni) begin
+      failover_hold_q      <= 1'b0;
+      tmr_on_q             <= 1'b0;
+      tmr_exit_q           <= 1'b0;
+      failover_instr_drain_q <= 1'b0;
+      failover_data_drain_q  <= 1'b0;
+      failover_master_q    <= '0;
+      failover_faulty_q    <= '0;
+      failover_instr_out_q <= '0;
+      failover_data_out_q  <= '0;
+    end else begin
+      failover_instr_out_q <= failover_instr_out_q + 3'(failover_instr_acc_s) - 3'(failover_instr_ret_s);
+      failover_data_out_q  <= failover_data_out_q + 3'(failover_data_acc_s) - 3'(failover_data_ret_s);
+      tmr_on_q             <= tmr_voter_enable_s;
+      tmr_exit_q           <= tmr_exit_s;
+      failover_instr_drain_q <= (failover_start_s || ((failover_hold_q || tmr_exit_s) && failover_instr_drain_q)) &&
+                                failover_instr_pend_s;
+      failover_data_drain_q  <= (failover_start_s || ((failover_hold_q || tmr_exit_s) && failover_data_drain_q)) &&
+                                failover_data_pend_s;
+
+      if (failover_trigger_s) begin
+        failover_hold_q   <= 1'b1;
+        failover_master_q <= failover_next_s;
+        failover_faulty_q <= master_core_ff_s;
+      end else if (failover_s || !tmr_voter_enable_s) begin
+        failover_hold_q <= 1'b0;
+      end
+    end
+  end
+
+  tmr_voter #(
+      .obi_req_t            (obi_req_t  ),
+      .obi_resp_t           (obi_resp_t )
+      ) tmr_voter0_i (
+      .clk_i,
+      .rst_ni,
+      // Instruction Bus
+      .core_instr_req_i(tmr0_core_instr_req_i),
+      .voted_core_instr_req_o(voted_core_instr_req_o[0]),
+      .voted_core_instr_gnt_i(port_instr_resp[0].gnt),
+      .core_instr_gnt_o(voted_core_instr_gnt[0]),
+      .enable_i(tmr_voter_enable_s && master_core_ff_s[0]),
+      // Data Bus
+      .core_data_req_i(tmr0_core_data_req_i),
+      .voted_core_data_req_o(voted_core_data_req_o[0]),
+      .voted_core_data_gnt_i(core_data_resp_i[0].gnt),
+      .core_data_gnt_o(voted_core_data_gnt[0]),
+      .instr_check_i(instr_check_s),
+      .data_check_i(data_check_s),
+      .load_check_i(load_check_s),
+
+      .error_o(tmr_error_s[0]),
+      .error_id_o(tmr_errorid_s[0]),
+      .error_field_o(tmr_field_s[0]),
+      .error_addr_o(tmr_addr_s[0])
+  );
+  tmr_voter #(
+      .obi_req_t            (obi_req_t  ),
+      .obi_resp_t           (obi_resp_t )
+      ) tmr_voter1_i (
+      .clk_i,
+      .rst_ni,
+      // Instruction Bus
+      .core_instr_req_i(tmr1_core_instr_req_i),
+      .voted_core_instr_req_o(voted_core_instr_req_o[1]),
+      .voted_core_instr_gnt_i(port_instr_resp[1].gnt),
+      .core_instr_gnt_o(voted_core_instr_gnt[1]),
+      .enable_i(tmr_voter_enable_s && master_core_ff_s[1]),
+      // Data Bus
+      .core_data_req_i(tmr1_core_data_req_i),
+      .voted_core_data_req_o(voted_core_data_req_o[1]),
+      .voted_core_data_gnt_i(core_data_resp_i[1].gnt),
+      .core_data_gnt_o(voted_core_data_gnt[1]),
+      .instr_check_i(instr_check_s),
+      .data_check_i(data_check_s),
+      .load_check_i(load_check_s),
+
+      .error_o(tmr_error_s[1]),
+      .error_id_o(tmr_errorid_s[1]),
+      .error_field_o(tmr_field_s[1]),
+      .error_addr_o(tmr_addr_s[1])
+  );
+  tmr_voter #(
+      .obi_req_t            (obi_req_t  ),
+      .obi_resp_t           (obi_resp_t )
+      ) tmr_voter2_i (
+      .clk_i,
+      .rst_ni,
+      // Instruction Bus
+      .core_instr_req_i(tmr2_core_instr_req_i),
+      .voted_core_instr_req_o(voted_core_instr_req_o[2]),
+      .voted_core_instr_gnt_i(port_instr_resp[2].gnt),
+      .core_instr_gnt_o(voted_core_instr_gnt[2]),
+      .enable_i(tmr_voter_enable_s && master_core_ff_s[2]),
+      // Data Bus
+      .core_data_req_i(tmr2_core_data_req_i),
+      .voted_core_data_req_o(voted_core_data_req_o[2]),
+      .voted_core_data_gnt_i(core_data_resp_i[2].gnt),
+      .core_data_gnt_o(voted_core_data_gnt[2]),
+      .instr_check_i(instr_check_s),
+      .data_check_i(data_check_s),
+      .load_check_i(load_check_s),
+
+      .error_o(tmr_error_s[2]),
+      .error_id_o(tmr_errorid_s[2]),
+      .error_field_o(tmr_field_s[2]),
+      .error_addr_o(tmr_addr_s[2])
+  );
+
+  //******************Relaxed checking********************//
+  //Accepted requests of the master port (voted or compared)
+  always_comb begin
+    check_instr_acc_s = 1'b0;
+    check_data_acc_s  = 1'b0;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (master_core_ff_s[i]) begin
+        check_instr_acc_s = port_instr_req[i].req && port_instr_resp[i].gnt;
+        check_data_acc_s  = core_data_req_o[i].req && core_data_resp_i[i].gnt;
+      end
+    end
+  end
+
+  check_policy check_policy_i (
+      .clk_i,
+      .rst_ni,
+      .critical_i(critical_section_s),
+      .stores_i(check_stores_s),
+      .sample_i(check_sample_s),
+      .nth_i(check_nth_s),
+      .instr_acc_i(check_instr_acc_s),
+      .data_acc_i(check_data_acc_s),
+      .instr_check_o(instr_check_s),
+      .data_check_o(data_check_s),
+      .load_check_o(load_check_s)
+  );
+
+  //******************Safety Comparator********************//
+  obi_req_t [NHARTS-1:0][1:0] dmr_core_instr_req_i;
+  obi_req_t [NHARTS-1:0][1:0] dmr_core_data_req_i;
+
+  obi_req_t [NHARTS-1:0][1:0] lockstep_mux_core_instr_req_i;
+  obi_req_t [NHARTS-1:0][1:0] lockstep_mux_core_data_req_i;
+
+  obi_req_t [NHARTS-1:0][1:0] lockstep_delayed_core_instr_req_i;
+  obi_req_t [NHARTS-1:0][1:0] lockstep_delayed_core_data_req_i;
+
+  always_comb begin
+    //Masters
+    //Comparador 0
+    dmr_core_instr_req_i[0][0] = upper_mux_core_instr_req_i[0][0];
+    dmr_core_data_req_i[0][0]  = upper_mux_core_data_req_i[0][0];
+    //Comparador 1
+    dmr_core_instr_req_i[1][0] = upper_mux_core_instr_req_i[1][1];
+    dmr_core_data_req_i[1][0]  = upper_mux_core_data_req_i[1][1];
+    //Comparador 2
+    dmr_core_instr_req_i[2][0] = upper_mux_core_instr_req_i[2][2];
+    dmr_core_data_req_i[2][0]  = upper_mux_core_data_req_i[2][2];
+
+    //Slaves Mux
+    if (dmr_config_s[1] == 1'b1) begin  //Mux Comparador 0 Mask 110
+      dmr_core_instr_req_i[0][1] = upper_mux_core_instr_req_i[1][0];
+      dmr_core_data_req_i[0][1]  = upper_mux_core_data_req_i[1][0];
+    end else begin  //Mux Comparador 0 Mask 101
+      dmr_core_instr_req_i[0][1] = upper_mux_core_instr_req_i[2][0];
+      dmr_core_data_req_i[0][1]  = upper_mux_core_data_req_i[2][0];
+    end
+
+    if (dmr_config_s[0] == 1'b1) begin  //Mux Comparador 1 Mask 110
+      dmr_core_instr_req_i[1][1] = upper_mux_core_instr_req_i[0][1];
+      dmr_core_data_req_i[1][1]  = upper_mux_core_data_req_i[0][1];
+    end else begin  //Mux Comparador 0 Mask 011
+      dmr_core_instr_req_i[1][1] = upper_mux_core_instr_req_i[2][1];
+      dmr_core_data_req_i[1][1]  = upper_mux_core_data_req_i[2][1];
+    end
+
+    if (dmr_config_s[1] == 1'b1) begin  //Mux Comparador 2 Mask 011
+      dmr_core_instr_req_i[2][1] = upper_mux_core_instr_req_i[1][2];
+      dmr_core_data_req_i[2][1]  = upper_mux_core_data_req_i[1][2];
+    end else begin  //Mux Comparador 0 Mask 101
+      dmr_core_instr_req_i[2][1] = upper_mux_core_instr_req_i[0][2];
+      dmr_core_data_req_i[2][1]  = upper_mux_core_data_req_i[0][2];
+    end
+  end
+
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_lockstep_mux_reg
+    always_comb begin
+      if (delayed_s && dual_mode_s) begin
+        lockstep_mux_core_instr_req_i[i] = lockstep_delayed_core_instr_req_i[i];
+        lockstep_mux_core_data_req_i[i]  = lockstep_delayed_core_data_req_i[i];
+      end else if (dual_mode_s) begin
+        lockstep_mux_core_instr_req_i[i] = dmr_core_instr_req_i[i];
+        lockstep_mux_core_data_req_i[i]  = dmr_core_data_req_i[i];
+      end else begin
+        lockstep_mux_core_instr_req_i[i] = '0;
+        lockstep_mux_core_data_req_i[i]  = '0;
+      end
+    end
+  end
+
+
+  for (genvar i = 0; i < NHARTS; i++) begin : sap_signals_mux_reg
+    always_comb begin
+      if (delayed_s && dual_mode_s) begin  // only if delayed mode
+        if (master_core_ff_s[i]) begin
+          core_intr_i[i] = intr[i];
+          core_debug_req_i[i] = debug_req[i];
+        end else if (dmr_config_s[i] && master_core_ff_s[0]) begin
+          core_intr_i[i] = delayed_intr_o;
+          core_debug_req_i[i] = delayed_debug_req_o;
+        end else if (dmr_config_s[i] && master_core_ff_s[1]) begin
+          core_intr_i[i] = delayed_intr_o;
+          core_debug_req_i[i] = delayed_debug_req_o;
+        end else if (dmr_config_s[i] && master_core_ff_s[2]) begin
+          core_intr_i[i] = delayed_intr_o;
+          core_debug_req_i[i] = delayed_debug_req_o;
+        end else begin  //default nothing
+          core_intr_i[i] = intr[i];
+          core_debug_req_i[i] = debug_req[i];
+        end
+      end else begin  //Others modes
+        core_intr_i[i] = intr[i];
+        core_debug_req_i[i] = debug_req[i];
+      end
+    end
+  end
+
+  always_comb begin : sap_lockstep_input_signals_mux_reg
+    if (delayed_s && dual_mode_s) begin  // only if delayed mode
+      if (!master_core_ff_s[0] && dmr_config_s[0]) begin
+        delayed_intr_i = intr[0];
+        delayed_debug_req_i = debug_req[0];
+      end else if (!master_core_ff_s[1] && dmr_config_s[1]) begin
+        delayed_intr_i = intr[1];
+        delayed_debug_req_i = debug_req[1];
+      end else begin
+        delayed_intr_i = intr[2];
+        delayed_debug_req_i = debug_req[2];
+      end
+    end else begin
+      delayed_intr_i = '0;
+      delayed_debug_req_i = '0;
+    end
+  end
+
+
+  for (genvar i = 0; i < NRCOMPARATORS; i++) begin : sap_dmr_lockstep_
+    obi_req_t [1:0] tight_core_instr_req_o, tight_core_data_req_o;
+    obi_resp_t [1:0] tight_core_instr_resp_o, tight_core_data_resp_o;
+    obi_resp_t [1:0] loose_core_instr_resp_o, loose_core_data_resp_o;
+
+    lockstep_reg #(
+        .obi_req_t            (obi_req_t  ),
+        .obi_resp_t           (obi_resp_t ),
+        .NCYCLES(NCYCLES)
+    ) lockstep_reg_i (
+        .clk_i,
+        .rst_ni,
+        .core_instr_req_i(dmr_core_instr_req_i[i]),
+        .core_instr_req_o(tight_core_instr_req_o),
+        .core_instr_resp_i(lower_mux_core_instr_resp_i[i][1]),
+        .core_instr_resp_o(tight_core_instr_resp_o),
+        .core_data_req_i(dmr_core_data_req_i[i]),
+        .core_data_req_o(tight_core_data_req_o),
+        .core_data_resp_i(lower_mux_core_data_resp_i[i][1]),
+        .core_data_resp_o(tight_core_data_resp_o),
+        .delay_i(delay_sel_s),
+        .enable_i(delayed_s && dual_mode_s && ~loose_s && ~dmr_wfi_s[i])
+    );
+
+    //Loose: the pair bypasses the comparator, the leading core drives the port
+    lockstep_loose #(
+        .obi_req_t            (obi_req_t  ),
+        .obi_resp_t           (obi_resp_t )
+    ) lockstep_loose_i (
+        .clk_i,
+        .rst_ni,
+        .enable_i(delayed_s && dual_mode_s && loose_s && ~dmr_wfi_s[i]),
+        .interval_i(lockstep_interval_s),
+        .intr_i(delayed_intr_i),
+        .debug_req_i(delayed_debug_req_i),
+        .intr_o(loose_intr_s[i]),
+        .debug_req_o(loose_debug_req_s[i]),
+        .core_instr_req_i(dmr_core_instr_req_i[i]),
+        .core_instr_resp_o(loose_core_instr_resp_o),
+        .core_data_req_i(dmr_core_data_req_i[i]),
+        .core_data_resp_o(loose_core_data_resp_o),
+        .instr_req_o(loose_core_instr_req_o[i]),
+        .instr_resp_i(lower_mux_core_instr_resp_i[i][1]),
+        .data_req_o(loose_core_data_req_o[i]),
+        .data_resp_i(lower_mux_core_data_resp_i[i][1]),
+        .error_o(loose_error_s[i])
+    );
+
+    always_comb begin
+      if (loose_s) begin
+        lockstep_delayed_core_instr_req_i[i] = '0;
+        lockstep_delayed_core_data_req_i[i]  = '0;
+        upper_delayed_core_instr_resp_i[i]   = loose_core_instr_resp_o;
+        upper_delayed_core_data_resp_i[i]    = loose_core_data_resp_o;
+      end else begin
+        lockstep_delayed_core_instr_req_i[i] = tight_core_instr_req_o;
+        lockstep_delayed_core_data_req_i[i]  = tight_core_data_req_o;
+        upper_delayed_core_instr_resp_i[i]   = tight_core_instr_resp_o;
+        upper_delayed_core_data_resp_i[i]    = tight_core_data_resp_o;
+      end
+    end
+
+    assign dmr_error_s[i] = cmp_error_s[i] | loose_error_s[i];
+  end
+
+  //Lockstep delay in use: 1..NCYCLES
+  assign delay_cfg_s = (lockstep_delay_s == '0) ? DelayWidth'(1) :
+                       (lockstep_delay_s > NCYCLES) ? DelayWidth'(NCYCLES) : DelayWidth'(lockstep_delay_s);
+
+  //Latched on entry to the delayed mode, Lockstep_Ctrl.DELAY writes inside it are ignored
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      delay_sel_s <= DelayWidth'(1);
+    end else if (!(delayed_s && dual_mode_s)) begin
+      delay_sel_s <= delay_cfg_s;
+    end
+  end
+
+  logic [NCYCLES-1:0]       debug_req_ff;
+  logic [NCYCLES-1:0][31:0] intr_ff;
+  logic                     enable_ff;
+
+  //Loose: the lines of the pair led by the master, at the leading request count
+  always_comb begin
+    delayed_intr_o = intr_ff[delay_sel_s-1];
+    delayed_debug_req_o = debug_req_ff[delay_sel_s-1];
+    if (loose_s) begin
+      for (int unsigned i = 0; i < NRCOMPARATORS; i++) begin
+        if (master_core_ff_s[i]) begin
+          delayed_intr_o = loose_intr_s[i];
+          delayed_debug_req_o = loose_debug_req_s[i];
+        end
+      end
+    end
+  end
+  assign enable_ff = delayed_s && dual_mode_s;
+
+  for (genvar j = 0; j < NCYCLES; j++) begin : N_Cycles_ff
+    if (j == 0) begin : gen_first
+
+      always_ff @(posedge clk_i or negedge rst_ni) begin : proc_ndelay
+        if (~rst_ni) begin
+          intr_ff[0]      <= '0;
+          debug_req_ff[0] <= '0;
+        end else if (enable_ff) begin
+          intr_ff[0]      <= delayed_intr_i;
+          debug_req_ff[0] <= delayed_debug_req_i;
+        end
+      end
+    end else begin : gen_rest
+
+      always_ff @(posedge clk_i or negedge rst_ni) begin : proc_ndelay
+        if (~rst_ni) begin
+          intr_ff[j]      <= '0;
+          debug_req_ff[j] <= '0;
+        end else if (enable_ff) begin
+          intr_ff[j]      <= intr_ff[j-1];
+          debug_req_ff[j] <= debug_req_ff[j-1];
+        end
+      end
+    end
+  end
+
+  for (genvar i = 0; i < NRCOMPARATORS; i++) begin : sap_dmr_comparator
+
+    dmr_comparator #(
+        .obi_req_t            (obi_req_t  ),
+        .obi_resp_t           (obi_resp_t )
+    ) dmr_comparator_i (
+        .clk_i,
+        .rst_ni,
+        .core_instr_req_i(lockstep_mux_core_instr_req_i[i]),
+        .compared_core_instr_req_o(compared_core_instr_req_o[i]),
+        .compared_core_instr_gnt_i(port_instr_resp[i].gnt),
+        .core_instr_gnt_o(compared_core_instr_gnt[i]),
+        .core_data_req_i(lockstep_mux_core_data_req_i[i]),
+        .compared_core_data_req_o(compared_core_data_req_o[i]),
+        .compared_core_data_gnt_i(core_data_resp_i[i].gnt),
+        .core_data_gnt_o(compared_core_data_gnt[i]),
+        .instr_check_i(instr_check_s),
+        .data_check_i(data_check_s),
+        .load_check_i(load_check_s),
+        .error_o(cmp_error_s[i]),
+        .error_data_o(cmp_data_error_s[i]),
+        .error_field_o(cmp_field_s[i]),
+        .error_addr_o(cmp_addr_s[i])
+    );
+  end
+
+  //******************Mismatch telemetry********************//
+  //Voter of the master in TCLS, comparator of the master pair in DCLS (both harts)
+  always_comb begin
+    mismatch_s       = 1'b0;
+    mismatch_field_s = '0;
+    mismatch_addr_s  = '0;
+    for (int unsigned i = 0; i < NHARTS; i++) begin
+      if (tmr_error_s[i]) begin
+        mismatch_s       = 1'b1;
+        mismatch_field_s = tmr_field_s[i];
+        mismatch_addr_s  = tmr_addr_s[i];
+      end
+    end
+    for (int unsigned i = 0; i < NRCOMPARATORS; i++) begin
+      if (master_core_ff_s[i] && dual_mode_s && cmp_error_s[i]) begin
+        mismatch_s = 1'b1;
+        mismatch_addr_s = cmp_addr_s[i];
+        for (int unsigned h = 0; h < NHARTS; h++) begin
+          if (dmr_config_s[h]) mismatch_field_s[h] = cmp_field_s[i];
+        end
+      end
+    end
+  end
+
+  //******************DCLS Tie-break********************//
+  obi_req_t [1:0] tb_pair_req;
+  logic tb_pair_gnt;
+  logic tb_error;
+  logic tb_data_error;
+  logic [NHARTS-1:0] tb_core_data_gnt;
+
+  always_comb begin
+    tb_pair_req   = '0;
+    tb_pair_gnt   = 1'b0;
+    tb_error      = 1'b0;
+    tb_data_error = 1'b0;
+    for (int unsigned i = 0; i < NRCOMPARATORS; i++) begin
+      if (master_core_ff_s[i]) begin
+        tb_pair_req   = lockstep_mux_core_data_req_i[i];
+        tb_pair_gnt   = compared_core_data_gnt[i];
+        tb_error      = dmr_error_s[i];
+        tb_data_error = cmp_data_error_s[i];
+      end
+    end
+  end
+
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_tb_gnt
+    assign tb_core_data_gnt[i] = mux_core_data_resp_o[i].gnt;
+  end
+
+  dmr_tiebreak #(
+      .obi_req_t (obi_req_t),
+      .obi_resp_t(obi_resp_t),
+      .NHARTS    (NHARTS)
+  ) dmr_tiebreak_i (
+      .clk_i,
+      .rst_ni,
+      .enable_i(dmr_tiebreak_en_s && dual_mode_s && !(delayed_s && loose_s)),
+      .master_i(master_core_ff_s),
+      .pair_i(dmr_config_s),
+      .pair_req_i(tb_pair_req),
+      .pair_gnt_i(tb_pair_gnt),
+      .error_i(tb_error),
+      .data_error_i(tb_data_error),
+      .core_data_req_i(mux_core_data_req_i),
+      .core_data_gnt_i(tb_core_data_gnt),
+      .start_i(tiebreak_start_s),
+      .done_o(tiebreak_done_s),
+      .halt_ack_i(debug_mode_s),
+      .sleep_i(sleep_s),
+      .hart_o(tb_hart_s),
+      .halt_o(tb_halt_s),
+      .hold_o(tb_hold_s),
+      .irq_o(tb_irq_s),
+      .isolate_o(tb_isolate_s),
+      .rec_o(tiebreak_rec_s),
+      .live_o(tiebreak_live_s),
+      .resolved_o(tiebreak_resolved_s),
+      .faulty_o(tiebreak_faulty_s)
+  );
+
+  //*******************************************************//
+
+  //***Fast sync: per-word valid of the safe copy***//
+  sync_track #(
+      .obi_req_t(obi_req_t),
+      .NHARTS   (NHARTS)
+  ) sync_track_i (
+      .clk_i,
+      .rst_ni,
+      .clear_i(sync_clear_s),
+      .track_i(sync_track_s),
+      .base_i(safe_copy_addr_s),
+      .master_i(master_core_s),
+      .core_data_req_i(mux_core_data_req_i),
+      .core_data_gnt_i(tb_core_data_gnt),
+      .hold_o(sync_hold_s)
+  );
+
+  //***Private CPU Register***//
+
+  for (genvar i = 0; i < NHARTS; i++) begin : priv_reg
+    // ARCHITECTURE
+    // ------------
+    //                ,---- SLAVE[0] (System Bus)
+    // CPUx <--> XBARx
+    //                `---- SLAVE[1] (Private Register)
+    //
+
+    //***CPU xbar***//
+    sap_xbar_varlat_one_to_n #(
+        .obi_req_t            (obi_req_t  ),
+        .obi_resp_t           (obi_resp_t ),
+        .XBAR_NSLAVE  (32'd2),
+        .NUM_RULES    (32'd1)
+    ) sap_xbar_varlat_one_to_n_i (
+        .clk_i(clk_i),
+        .rst_ni(rst_ni),
+        .addr_map_i(sap_pkg::CPU_XBAR_ADDR_RULES),
+        .default_idx_i(1'b0),                   //in case of not known decoded address it's forwarded down to system bus
+        .master_req_i(core_data_req[i]),
+        .master_resp_o(core_data_resp[i]),
+        .slave_req_o(xbar_core_data_req[i]),
+        .slave_resp_i(xbar_core_data_resp[i])
+    );
+
+    //***OBI Slave[1] -> Private Address CPU Register***//
+    periph_to_reg #(
+        .req_t(reg_pkg::reg_req_t),
+        .rsp_t(reg_pkg::reg_rsp_t),
+        .IW(1)
+    ) cpu_periph_to_reg_i (
+        .clk_i,
+        .rst_ni,
+        .req_i(xbar_core_data_req[i][1].req),
+        .add_i(xbar_core_data_req[i][1].addr),
+        .wen_i(~xbar_core_data_req[i][1].we),
+        .wdata_i(xbar_core_data_req[i][1].wdata),
+        .be_i(xbar_core_data_req[i][1].be),
+        .id_i('0),
+        .gnt_o(xbar_core_data_resp[i][1].gnt),
+        .r_rdata_o(xbar_core_data_resp[i][1].rdata),
+        .r_opc_o(),
+        .r_id_o(),
+        .r_valid_o(xbar_core_data_resp[i][1].rvalid),
+        .reg_req_o(cpu_reg_req[i]),
+        .reg_rsp_i(cpu_reg_rsp[i])
+    );
+
+    //***CPU Private Register***//
+
+    cpu_private_reg #(
+        .reg_req_t(reg_pkg::reg_req_t),
+        .reg_rsp_t(reg_pkg::reg_rsp_t)
+    ) cpu_private_reg_i (
+        .clk_i,
+        .rst_ni,
+
+        // Bus Interface
+        .reg_req_i(cpu_reg_req[i]),
+        .reg_rsp_o(cpu_reg_rsp[i]),
+
+        .Core_id_i(Core_ID[i]),
+        .Hart_intc_ack_o(Hart_intc_ack_s[i])
+    );
+  end
+endmodule
@@ -0,0 +1,101 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Telemetry of the voter/comparator mismatches, read through the Tel_* CSRs.
+//  - One event per mismatch (rising edge of error_i, the flags stay up
+//    while the harts are stopped).
+//  - Saturating counter per hart and per field ({wdata, be, we, addr, req}),
+//    a DCLS mismatch counts on both harts of the pair.
+//  - Ring buffer of the last RING_DEPTH events: address, timestamp (time_i,
+//    the CYCLE_COUNT of the running job) and {harts, fields}.
+//  - clear_i resets the counters and the ring.
+
+module safe_telemetry #(
+    parameter NHARTS = 3,
+    parameter int unsigned CNT_WIDTH = 10,
+    parameter int unsigned RING_DEPTH = 4,
+    // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
+    parameter int unsigned RingIdxWidth = RING_DEPTH > 1 ? $clog2(RING_DEPTH) : 1
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    input logic clear_i,
+
+    // Mismatch
+    input logic error_i,
+    input logic [NHARTS-1:0][4:0] field_i,
+    input logic [31:0] addr_i,
+    input logic [31:0] time_i,
+
+    // Counters
+    output logic [4:0][NHARTS-1:0][CNT_WIDTH-1:0] cnt_o,
+
+    // Ring
+    output logic [RingIdxWidth-1:0] ring_next_o,
+    output logic [RING_DEPTH-1:0] ring_valid_o,
+    output logic [RING_DEPTH-1:0][31:0] ring_addr_o,
+    output logic [RING_DEPTH-1:0][31:0] ring_time_o,
+    output logic [RING_DEPTH-1:0][NHARTS+4:0] ring_info_o
+);
+
+  logic error_q;
+  logic event_s;
+  logic [NHARTS-1:0] harts_s;
+  logic [4:0] fields_s;
+
+  assign event_s = error_i && !error_q;
+
+  always_comb begin
+    fields_s = '0;
+    for (int unsigned h = 0; h < NHARTS; h++) begin
+      harts_s[h] = |field_i[h];
+      fields_s   = fields_s | field_i[h];
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      error_q <= 1'b0;
+    end else begin
+      error_q <= error_i;
+    end
+  end
+
+  //Counters
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      cnt_o <= '0;
+    end else if (clear_i) begin
+      cnt_o <= '0;
+    end else if (event_s) begin
+      for (int unsigned f = 0; f < 5; f++) begin
+        for (int unsigned h = 0; h < NHARTS; h++) begin
+          if (field_i[h][f] && (cnt_o[f][h] != '1)) cnt_o[f][h] <= cnt_o[f][h] + 1'b1;
+        end
+      end
+    end
+  end
+
+  //Ring
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      ring_next_o  <= '0;
+      ring_valid_o <= '0;
+      ring_addr_o  <= '0;
+      ring_time_o  <= '0;
+      ring_info_o  <= '0;
+    end else if (clear_i) begin
+      ring_next_o  <= '0;
+      ring_valid_o <= '0;
+    end else if (event_s) begin
+      ring_valid_o[ring_next_o] <= 1'b1;
+      ring_addr_o[ring_next_o]  <= addr_i;
+      ring_time_o[ring_next_o]  <= time_i;
+      ring_info_o[ring_next_o]  <= {harts_s, fields_s};
+      ring_next_o <= (32'(ring_next_o) == RING_DEPTH - 1) ? '0 : ring_next_o + 1'b1;
+    end
+  end
+
+endmodule
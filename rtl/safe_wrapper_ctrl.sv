@@ -27,6 +27,47 @@ module safe_wrapper_ctrl #(
     output logic Start_o,
     output logic End_sw_routine_o,
 
+    // System xbar QoS
+    output sap_pkg::xbar_qos_t xbar_qos_o,
+
+    // RAM ECC
+    output logic mem_scrub_en_o,
+    input logic [7:0] ecc_corrected_i,
+    input logic [7:0] ecc_uncorrected_i,
+
+    // Loose lockstep
+    output logic lockstep_loose_o,
+    output logic [3:0] lockstep_delay_o,
+    output logic [23:0] lockstep_interval_o,
+
+    // DCLS tie-break
+    output logic dmr_tiebreak_en_o,
+    input logic tiebreak_live_i,
+    input logic tiebreak_done_i,
+    input logic tiebreak_resolved_i,
+    input logic [NHARTS-1 : 0] tiebreak_faulty_i,
+
+    // TCLS master failover
+    output logic tmr_failover_en_o,
+    input logic failover_i,
+    input logic [NHARTS-1 : 0] failover_master_i,
+    input logic [NHARTS-1 : 0] failover_faulty_i,
+
+    // Redundant mode entry
+    output logic fast_sync_o,
+    output logic [31:0] safe_copy_addr_o,
+    input logic sync_busy_i,
+
+    // Relaxed checking outside critical sections
+    output logic check_stores_o,
+    output logic check_sample_o,
+    output logic [7:0] check_nth_o,
+
+    // Voter/comparator mismatch telemetry
+    input logic mismatch_i,
+    input logic [NHARTS-1 : 0][4:0] mismatch_field_i,
+    input logic [31:0] mismatch_addr_i,
+
     input logic Start_Boot_i,
     input logic en_ext_debug_i,
     input logic DMR_Rec_i,
@@ -74,6 +115,202 @@ module safe_wrapper_ctrl #(
   assign hw2reg.end_sw_routine.d = 1'b0;
   assign hw2reg.end_sw_routine.de = Start_Flag;
 
+  //QoS
+  //Register slots: instr/data of the group harts 0..2 (shared by every group), external, DMA
+  logic [7:0][1:0] qos_prio;
+  logic [7:0][3:0] qos_weight;
+  logic [7:0][7:0] qos_bw_cap;
+
+  assign qos_prio   = reg2hw.qos_priority.q;
+  assign qos_weight = reg2hw.qos_weight.q;
+  assign qos_bw_cap = {reg2hw.qos_bw_cap1.q, reg2hw.qos_bw_cap0.q};
+
+  always_comb begin
+    for (int unsigned m = 0; m < sap_pkg::SYSTEM_XBAR_NMASTER; m++) begin
+      int unsigned slot;
+      if (m == sap_pkg::EXTERNAL_MASTER_IDX) slot = 6;
+      else if (m == sap_pkg::DMA_MASTER_IDX) slot = 7;
+      else slot = m % (2 * sap_pkg::HARTS_PER_GROUP);
+      xbar_qos_o.prio[m]   = qos_prio[slot];
+      xbar_qos_o.weight[m] = qos_weight[slot];
+      xbar_qos_o.bw_cap[m] = qos_bw_cap[slot];
+    end
+  end
+  assign xbar_qos_o.bw_window = reg2hw.qos_bw_window.q;
+
+  //ECC
+  //Saturating counters of the errors reported by the RAM banks in each cycle
+  logic [31:0] ecc_corrected_cnt, ecc_uncorrected_cnt;
+  logic [32:0] ecc_corrected_sum, ecc_uncorrected_sum;
+
+  assign mem_scrub_en_o = reg2hw.ecc_ctrl.q;
+
+  assign ecc_corrected_sum = {1'b0, ecc_corrected_cnt} + 33'(ecc_corrected_i);
+  assign ecc_uncorrected_sum = {1'b0, ecc_uncorrected_cnt} + 33'(ecc_uncorrected_i);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      ecc_corrected_cnt   <= '0;
+      ecc_uncorrected_cnt <= '0;
+    end else begin
+      ecc_corrected_cnt   <= ecc_corrected_sum[32] ? '1 : ecc_corrected_sum[31:0];
+      ecc_uncorrected_cnt <= ecc_uncorrected_sum[32] ? '1 : ecc_uncorrected_sum[31:0];
+    end
+  end
+
+  assign hw2reg.ecc_corrected.d = ecc_corrected_cnt;
+  assign hw2reg.ecc_corrected.de = 1'b1;
+  assign hw2reg.ecc_uncorrected.d = ecc_uncorrected_cnt;
+  assign hw2reg.ecc_uncorrected.de = 1'b1;
+
+  //Lockstep
+  assign lockstep_loose_o = reg2hw.lockstep_ctrl.loose.q;
+  assign lockstep_delay_o = reg2hw.lockstep_ctrl.delay.q;
+  assign lockstep_interval_o = reg2hw.lockstep_ctrl.interval.q;
+
+  //DCLS tie-break, result of the last one kept until the next
+  assign dmr_tiebreak_en_o = reg2hw.dmr_tiebreak.q;
+  assign hw2reg.dmr_tiebreak_status.live.d = tiebreak_live_i;
+  assign hw2reg.dmr_tiebreak_status.live.de = 1'b1;
+  assign hw2reg.dmr_tiebreak_status.resolved.d = tiebreak_resolved_i;
+  assign hw2reg.dmr_tiebreak_status.resolved.de = tiebreak_done_i;
+  assign hw2reg.dmr_tiebreak_status.faulty.d = tiebreak_faulty_i;
+  assign hw2reg.dmr_tiebreak_status.faulty.de = tiebreak_done_i;
+
+  //TCLS master failover: the promoted hart becomes Master_core
+  logic [7:0] failover_cnt;
+
+  assign tmr_failover_en_o = reg2hw.tmr_failover.q;
+  assign hw2reg.master_core.d = failover_master_i;
+  assign hw2reg.master_core.de = failover_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      failover_cnt <= '0;
+    end else begin
+      if (failover_i && failover_cnt != 8'hFF) failover_cnt <= failover_cnt + 8'd1;
+    end
+  end
+
+  assign hw2reg.tmr_failover_status.count.d   = failover_cnt;
+  assign hw2reg.tmr_failover_status.count.de  = 1'b1;
+  assign hw2reg.tmr_failover_status.faulty.d  = failover_faulty_i;
+  assign hw2reg.tmr_failover_status.faulty.de = failover_i;
+
+  //Redundant mode entry: cycles from the switch request to the synchronized start
+  logic sync_busy_ff;
+  logic [31:0] sync_cnt;
+
+  assign fast_sync_o = reg2hw.sync_ctrl.q;
+  assign safe_copy_addr_o = reg2hw.safe_copy_address.q;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      sync_busy_ff <= 1'b0;
+      sync_cnt     <= '0;
+    end else begin
+      sync_busy_ff <= sync_busy_i;
+      if (sync_busy_i && !sync_busy_ff) sync_cnt <= 32'd1;
+      else if (sync_busy_i && sync_cnt != '1) sync_cnt <= sync_cnt + 32'd1;
+    end
+  end
+
+  assign hw2reg.sync_latency.d  = sync_cnt;
+  assign hw2reg.sync_latency.de = 1'b1;
+
+  //Relaxed checking
+  assign check_stores_o = reg2hw.check_policy.stores.q;
+  assign check_sample_o = reg2hw.check_policy.sample.q;
+  assign check_nth_o    = reg2hw.check_policy.nth.q;
+
+  //Mismatch telemetry
+  logic [4:0][NHARTS-1:0][9:0] tel_cnt;
+  logic [1:0] tel_ring_next;
+  logic [3:0] tel_ring_valid;
+  logic [3:0][31:0] tel_ring_addr, tel_ring_time;
+  logic [3:0][7:0] tel_ring_info;
+  logic [31:0] cycle_count;  //timestamp of the ring entries
+
+  safe_telemetry #(
+      .NHARTS    (NHARTS),
+      .CNT_WIDTH (10),
+      .RING_DEPTH(4)
+  ) safe_telemetry_i (
+      .clk_i,
+      .rst_ni,
+      .clear_i(reg2hw.tel_clear.qe && reg2hw.tel_clear.q),
+      .error_i(mismatch_i),
+      .field_i(mismatch_field_i),
+      .addr_i(mismatch_addr_i),
+      .time_i(cycle_count),
+      .cnt_o(tel_cnt),
+      .ring_next_o(tel_ring_next),
+      .ring_valid_o(tel_ring_valid),
+      .ring_addr_o(tel_ring_addr),
+      .ring_time_o(tel_ring_time),
+      .ring_info_o(tel_ring_info)
+  );
+
+  assign hw2reg.tel_cnt_req.hart0.d   = tel_cnt[0][0];
+  assign hw2reg.tel_cnt_req.hart1.d   = tel_cnt[0][1];
+  assign hw2reg.tel_cnt_req.hart2.d   = tel_cnt[0][2];
+  assign hw2reg.tel_cnt_addr.hart0.d  = tel_cnt[1][0];
+  assign hw2reg.tel_cnt_addr.hart1.d  = tel_cnt[1][1];
+  assign hw2reg.tel_cnt_addr.hart2.d  = tel_cnt[1][2];
+  assign hw2reg.tel_cnt_we.hart0.d    = tel_cnt[2][0];
+  assign hw2reg.tel_cnt_we.hart1.d    = tel_cnt[2][1];
+  assign hw2reg.tel_cnt_we.hart2.d    = tel_cnt[2][2];
+  assign hw2reg.tel_cnt_be.hart0.d    = tel_cnt[3][0];
+  assign hw2reg.tel_cnt_be.hart1.d    = tel_cnt[3][1];
+  assign hw2reg.tel_cnt_be.hart2.d    = tel_cnt[3][2];
+  assign hw2reg.tel_cnt_wdata.hart0.d = tel_cnt[4][0];
+  assign hw2reg.tel_cnt_wdata.hart1.d = tel_cnt[4][1];
+  assign hw2reg.tel_cnt_wdata.hart2.d = tel_cnt[4][2];
+  assign hw2reg.tel_cnt_req.hart0.de   = 1'b1;
+  assign hw2reg.tel_cnt_req.hart1.de   = 1'b1;
+  assign hw2reg.tel_cnt_req.hart2.de   = 1'b1;
+  assign hw2reg.tel_cnt_addr.hart0.de  = 1'b1;
+  assign hw2reg.tel_cnt_addr.hart1.de  = 1'b1;
+  assign hw2reg.tel_cnt_addr.hart2.de  = 1'b1;
+  assign hw2reg.tel_cnt_we.hart0.de    = 1'b1;
+  assign hw2reg.tel_cnt_we.hart1.de    = 1'b1;
+  assign hw2reg.tel_cnt_we.hart2.de    = 1'b1;
+  assign hw2reg.tel_cnt_be.hart0.de    = 1'b1;
+  assign hw2reg.tel_cnt_be.hart1.de    = 1'b1;
+  assign hw2reg.tel_cnt_be.hart2.de    = 1'b1;
+  assign hw2reg.tel_cnt_wdata.hart0.de = 1'b1;
+  assign hw2reg.tel_cnt_wdata.hart1.de = 1'b1;
+  assign hw2reg.tel_cnt_wdata.hart2.de = 1'b1;
+
+  assign hw2reg.tel_ring_status.next.d   = tel_ring_next;
+  assign hw2reg.tel_ring_status.next.de  = 1'b1;
+  assign hw2reg.tel_ring_status.valid.d  = tel_ring_valid;
+  assign hw2reg.tel_ring_status.valid.de = 1'b1;
+  assign hw2reg.tel_ring_info.entry0.d   = tel_ring_info[0];
+  assign hw2reg.tel_ring_info.entry1.d   = tel_ring_info[1];
+  assign hw2reg.tel_ring_info.entry2.d   = tel_ring_info[2];
+  assign hw2reg.tel_ring_info.entry3.d   = tel_ring_info[3];
+  assign hw2reg.tel_ring_info.entry0.de  = 1'b1;
+  assign hw2reg.tel_ring_info.entry1.de  = 1'b1;
+  assign hw2reg.tel_ring_info.entry2.de  = 1'b1;
+  assign hw2reg.tel_ring_info.entry3.de  = 1'b1;
+  assign hw2reg.tel_ring_addr0.d  = tel_ring_addr[0];
+  assign hw2reg.tel_ring_addr1.d  = tel_ring_addr[1];
+  assign hw2reg.tel_ring_addr2.d  = tel_ring_addr[2];
+  assign hw2reg.tel_ring_addr3.d  = tel_ring_addr[3];
+  assign hw2reg.tel_ring_addr0.de = 1'b1;
+  assign hw2reg.tel_ring_addr1.de = 1'b1;
+  assign hw2reg.tel_ring_addr2.de = 1'b1;
+  assign hw2reg.tel_ring_addr3.de = 1'b1;
+  assign hw2reg.tel_ring_time0.d  = tel_ring_time[0];
+  assign hw2reg.tel_ring_time1.d  = tel_ring_time[1];
+  assign hw2reg.tel_ring_time2.d  = tel_ring_time[2];
+  assign hw2reg.tel_ring_time3.d  = tel_ring_time[3];
+  assign hw2reg.tel_ring_time0.de = 1'b1;
+  assign hw2reg.tel_ring_time1.de = 1'b1;
+  assign hw2reg.tel_ring_time2.de = 1'b1;
+  assign hw2reg.tel_ring_time3.de = 1'b1;
+
   //Initial_Sync
   assign Initial_Sync_Master_o = reg2hw.initial_sync_master.q;
 
@@ -126,11 +363,59 @@ module safe_wrapper_ctrl #(
   end
 
 
+  //Cycle Count
+  //Cleared when START rises, counts while the job runs (START is cleared at End_SW)
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      cycle_count <= '0;
+    end else begin
+      if (enable) cycle_count <= '0;
+      else if (reg2hw.start.q) cycle_count <= cycle_count + 32'd1;
+    end
+  end
+
+  assign hw2reg.cycle_count.d  = cycle_count;
+  assign hw2reg.cycle_count.de = 1'b1;
+
+  //Interrupt Coalescing
+  //The interrupt status is set after THRESHOLD finished jobs or TIMEOUT cycles
+  //after the first pending job, whichever comes first.
+  logic [7:0] coalesce_cnt;
+  logic [23:0] coalesce_timer;
+  logic coalesce_fire;
+  logic [7:0] coalesce_threshold;
+  logic [23:0] coalesce_timeout;
+
+  assign coalesce_threshold = reg2hw.intc_coalesce.threshold.q;
+  assign coalesce_timeout = reg2hw.intc_coalesce.timeout.q;
+
+  assign coalesce_fire = (coalesce_cnt != '0) &&
+                         ((coalesce_cnt >= coalesce_threshold) ||
+                          ((coalesce_timeout != '0) && (coalesce_timer >= coalesce_timeout)));
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      coalesce_cnt   <= '0;
+      coalesce_timer <= '0;
+    end else begin
+      if (coalesce_fire) begin
+        coalesce_cnt   <= {7'b0, enable_endSW};
+        coalesce_timer <= '0;
+      end else begin
+        if (enable_endSW && coalesce_cnt != '1) coalesce_cnt <= coalesce_cnt + 8'd1;
+        if (coalesce_cnt != '0 && coalesce_timer != '1) coalesce_timer <= coalesce_timer + 24'd1;
+      end
+    end
+  end
+
+  assign hw2reg.coalesced_jobs.d  = coalesce_cnt;
+  assign hw2reg.coalesced_jobs.de = coalesce_fire;
+
   logic enable_interrupt;
 
   //Interrupt
   assign hw2reg.interrupt_controler.status_interrupt.d = '1;
-  assign hw2reg.interrupt_controler.status_interrupt.de = enable_endSW;
+  assign hw2reg.interrupt_controler.status_interrupt.de = coalesce_fire;
   assign enable_interrupt = reg2hw.interrupt_controler.enable_interrupt.q;
 
 
@@ -139,8 +424,10 @@ module safe_wrapper_ctrl #(
   logic flag_intc;
 
   assign status_interrupt = reg2hw.interrupt_controler.status_interrupt.q;
+  //Raised on the coalescing condition (STATUS_INTERRUPT), even if a later job
+  //already restarted the cores
   //synopsys sync_set_reset "load_intc"
-  assign load_intc = enable_interrupt & status_interrupt & sleep_i[0] & sleep_i[1] & sleep_i[2] & en_sw_routineff & ~flag_intc ;
+  assign load_intc = enable_interrupt & status_interrupt & ~flag_intc;
   //synopsys sync_set_reset "clear_intc"
   assign clear_intc = ~status_interrupt;
 
@@ -10,7 +10,7 @@
 module safe_wrapper_ctrl_reg_top #(
     parameter type reg_req_t = logic,
     parameter type reg_rsp_t = logic,
-    parameter int AW = 6
+    parameter int AW = 8
 ) (
     input logic clk_i,
     input logic rst_ni,
@@ -111,6 +111,112 @@ module safe_wrapper_ctrl_reg_top #(
   logic [31:0] initial_stack_addr_qs;
   logic [31:0] initial_stack_addr_wd;
   logic initial_stack_addr_we;
+  logic [31:0] exit_status_qs;
+  logic [31:0] exit_status_wd;
+  logic exit_status_we;
+  logic [31:0] cycle_count_qs;
+  logic [7:0] intc_coalesce_threshold_qs;
+  logic [7:0] intc_coalesce_threshold_wd;
+  logic intc_coalesce_threshold_we;
+  logic [23:0] intc_coalesce_timeout_qs;
+  logic [23:0] intc_coalesce_timeout_wd;
+  logic intc_coalesce_timeout_we;
+  logic [7:0] coalesced_jobs_qs;
+  logic warm_boot_qs;
+  logic warm_boot_wd;
+  logic warm_boot_we;
+  logic [31:0] warm_entry_qs;
+  logic [31:0] warm_entry_wd;
+  logic warm_entry_we;
+  logic [31:0] warm_checksum_qs;
+  logic [31:0] warm_checksum_wd;
+  logic warm_checksum_we;
+  logic [15:0] qos_priority_qs;
+  logic [15:0] qos_priority_wd;
+  logic qos_priority_we;
+  logic [31:0] qos_weight_qs;
+  logic [31:0] qos_weight_wd;
+  logic qos_weight_we;
+  logic [15:0] qos_bw_window_qs;
+  logic [15:0] qos_bw_window_wd;
+  logic qos_bw_window_we;
+  logic [31:0] qos_bw_cap0_qs;
+  logic [31:0] qos_bw_cap0_wd;
+  logic qos_bw_cap0_we;
+  logic [31:0] qos_bw_cap1_qs;
+  logic [31:0] qos_bw_cap1_wd;
+  logic qos_bw_cap1_we;
+  logic ecc_ctrl_qs;
+  logic ecc_ctrl_wd;
+  logic ecc_ctrl_we;
+  logic [31:0] ecc_corrected_qs;
+  logic [31:0] ecc_uncorrected_qs;
+  logic lockstep_ctrl_loose_qs;
+  logic lockstep_ctrl_loose_wd;
+  logic lockstep_ctrl_loose_we;
+  logic [3:0] lockstep_ctrl_delay_qs;
+  logic [3:0] lockstep_ctrl_delay_wd;
+  logic lockstep_ctrl_delay_we;
+  logic [23:0] lockstep_ctrl_interval_qs;
+  logic [23:0] lockstep_ctrl_interval_wd;
+  logic lockstep_ctrl_interval_we;
+  logic dmr_tiebreak_qs;
+  logic dmr_tiebreak_wd;
+  logic dmr_tiebreak_we;
+  logic dmr_tiebreak_status_live_qs;
+  logic dmr_tiebreak_status_resolved_qs;
+  logic [2:0] dmr_tiebreak_status_faulty_qs;
+  logic dmr_checkpoint_wd;
+  logic dmr_checkpoint_we;
+  logic [9:0] tel_cnt_req_hart0_qs;
+  logic [9:0] tel_cnt_req_hart1_qs;
+  logic [9:0] tel_cnt_req_hart2_qs;
+  logic [9:0] tel_cnt_addr_hart0_qs;
+  logic [9:0] tel_cnt_addr_hart1_qs;
+  logic [9:0] tel_cnt_addr_hart2_qs;
+  logic [9:0] tel_cnt_we_hart0_qs;
+  logic [9:0] tel_cnt_we_hart1_qs;
+  logic [9:0] tel_cnt_we_hart2_qs;
+  logic [9:0] tel_cnt_be_hart0_qs;
+  logic [9:0] tel_cnt_be_hart1_qs;
+  logic [9:0] tel_cnt_be_hart2_qs;
+  logic [9:0] tel_cnt_wdata_hart0_qs;
+  logic [9:0] tel_cnt_wdata_hart1_qs;
+  logic [9:0] tel_cnt_wdata_hart2_qs;
+  logic [1:0] tel_ring_status_next_qs;
+  logic [3:0] tel_ring_status_valid_qs;
+  logic [7:0] tel_ring_info_entry0_qs;
+  logic [7:0] tel_ring_info_entry1_qs;
+  logic [7:0] tel_ring_info_entry2_qs;
+  logic [7:0] tel_ring_info_entry3_qs;
+  logic [31:0] tel_ring_addr0_qs;
+  logic [31:0] tel_ring_addr1_qs;
+  logic [31:0] tel_ring_addr2_qs;
+  logic [31:0] tel_ring_addr3_qs;
+  logic [31:0] tel_ring_time0_qs;
+  logic [31:0] tel_ring_time1_qs;
+  logic [31:0] tel_ring_time2_qs;
+  logic [31:0] tel_ring_time3_qs;
+  logic tel_clear_wd;
+  logic tel_clear_we;
+  logic tmr_failover_qs;
+  logic tmr_failover_wd;
+  logic tmr_failover_we;
+  logic [7:0] tmr_failover_status_count_qs;
+  logic [2:0] tmr_failover_status_faulty_qs;
+  logic sync_ctrl_qs;
+  logic sync_ctrl_wd;
+  logic sync_ctrl_we;
+  logic [31:0] sync_latency_qs;
+  logic check_policy_stores_qs;
+  logic check_policy_stores_wd;
+  logic check_policy_stores_we;
+  logic check_policy_sample_qs;
+  logic check_policy_sample_wd;
+  logic check_policy_sample_we;
+  logic [7:0] check_policy_nth_qs;
+  logic [7:0] check_policy_nth_wd;
+  logic check_policy_nth_we;
 
   // Register instances
   // R[safe_configuration]: V(False)
@@ -182,8 +288,8 @@ module safe_wrapper_ctrl_reg_top #(
       .wd(master_core_wd),
 
       // from internal hardware
-      .de(1'b0),
-      .d ('0),
+      .de(hw2reg.master_core.de),
+      .d (hw2reg.master_core.d),
 
       // to internal hardware
       .qe(),
@@ -402,7 +508,7 @@ module safe_wrapper_ctrl_reg_top #(
 
       // to internal hardware
       .qe(),
-      .q (),
+      .q (reg2hw.safe_copy_address.q),
 
       // to register interface (read)
       .qs(safe_copy_address_qs)
@@ -568,153 +674,2107 @@ module safe_wrapper_ctrl_reg_top #(
   );
 
 
+  // R[exit_status]: V(False)
 
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_exit_status (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
 
-  logic [14:0] addr_hit;
-  always_comb begin
-    addr_hit = '0;
-    addr_hit[0] = (reg_addr == SAFE_WRAPPER_CTRL_SAFE_CONFIGURATION_OFFSET);
-    addr_hit[1] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_MASK_OFFSET);
-    addr_hit[2] = (reg_addr == SAFE_WRAPPER_CTRL_MASTER_CORE_OFFSET);
-    addr_hit[3] = (reg_addr == SAFE_WRAPPER_CTRL_CRITICAL_SECTION_OFFSET);
-    addr_hit[4] = (reg_addr == SAFE_WRAPPER_CTRL_START_OFFSET);
-    addr_hit[5] = (reg_addr == SAFE_WRAPPER_CTRL_BOOT_ADDRESS_OFFSET);
-    addr_hit[6] = (reg_addr == SAFE_WRAPPER_CTRL_EXTERNAL_DEBUG_REQ_OFFSET);
-    addr_hit[7] = (reg_addr == SAFE_WRAPPER_CTRL_INITIAL_SYNC_MASTER_OFFSET);
-    addr_hit[8] = (reg_addr == SAFE_WRAPPER_CTRL_END_SW_ROUTINE_OFFSET);
-    addr_hit[9] = (reg_addr == SAFE_WRAPPER_CTRL_ENTRY_ADDRESS_OFFSET);
-    addr_hit[10] = (reg_addr == SAFE_WRAPPER_CTRL_SAFE_COPY_ADDRESS_OFFSET);
-    addr_hit[11] = (reg_addr == SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER_OFFSET);
-    addr_hit[12] = (reg_addr == SAFE_WRAPPER_CTRL_CB_HEEP_STATUS_OFFSET);
-    addr_hit[13] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_REC_OFFSET);
-    addr_hit[14] = (reg_addr == SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR_OFFSET);
-  end
+      // from register interface
+      .we(exit_status_we),
+      .wd(exit_status_wd),
 
-  assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0;
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
 
-  // Check sub-word write is permitted
-  always_comb begin
-    wr_err = (reg_we &
-              ((addr_hit[ 0] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 0] & ~reg_be))) |
-               (addr_hit[ 1] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 1] & ~reg_be))) |
-               (addr_hit[ 2] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 2] & ~reg_be))) |
-               (addr_hit[ 3] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 3] & ~reg_be))) |
-               (addr_hit[ 4] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 4] & ~reg_be))) |
-               (addr_hit[ 5] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 5] & ~reg_be))) |
-               (addr_hit[ 6] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 6] & ~reg_be))) |
-               (addr_hit[ 7] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 7] & ~reg_be))) |
-               (addr_hit[ 8] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 8] & ~reg_be))) |
-               (addr_hit[ 9] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 9] & ~reg_be))) |
-               (addr_hit[10] & (|(SAFE_WRAPPER_CTRL_PERMIT[10] & ~reg_be))) |
-               (addr_hit[11] & (|(SAFE_WRAPPER_CTRL_PERMIT[11] & ~reg_be))) |
-               (addr_hit[12] & (|(SAFE_WRAPPER_CTRL_PERMIT[12] & ~reg_be))) |
-               (addr_hit[13] & (|(SAFE_WRAPPER_CTRL_PERMIT[13] & ~reg_be))) |
-               (addr_hit[14] & (|(SAFE_WRAPPER_CTRL_PERMIT[14] & ~reg_be)))));
-  end
+      // to internal hardware
+      .qe(),
+      .q (),
 
-  assign safe_configuration_we = addr_hit[0] & reg_we & !reg_error;
-  assign safe_configuration_wd = reg_wdata[1:0];
+      // to register interface (read)
+      .qs(exit_status_qs)
+  );
 
-  assign dmr_mask_we = addr_hit[1] & reg_we & !reg_error;
-  assign dmr_mask_wd = reg_wdata[2:0];
 
-  assign master_core_we = addr_hit[2] & reg_we & !reg_error;
-  assign master_core_wd = reg_wdata[2:0];
+  // R[cycle_count]: V(False)
 
-  assign critical_section_we = addr_hit[3] & reg_we & !reg_error;
-  assign critical_section_wd = reg_wdata[0];
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_cycle_count (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
 
-  assign start_we = addr_hit[4] & reg_we & !reg_error;
-  assign start_wd = reg_wdata[0];
+      .we(1'b0),
+      .wd('0),
 
-  assign boot_address_we = addr_hit[5] & reg_we & !reg_error;
-  assign boot_address_wd = reg_wdata[31:0];
+      // from internal hardware
+      .de(hw2reg.cycle_count.de),
+      .d (hw2reg.cycle_count.d),
 
-  assign initial_sync_master_we = addr_hit[7] & reg_we & !reg_error;
-  assign initial_sync_master_wd = reg_wdata[0];
+      // to internal hardware
+      .qe(),
+      .q (),
 
-  assign end_sw_routine_we = addr_hit[8] & reg_we & !reg_error;
-  assign end_sw_routine_wd = reg_wdata[0];
+      // to register interface (read)
+      .qs(cycle_count_qs)
+  );
 
-  assign entry_address_we = addr_hit[9] & reg_we & !reg_error;
-  assign entry_address_wd = reg_wdata[31:0];
 
-  assign safe_copy_address_we = addr_hit[10] & reg_we & !reg_error;
-  assign safe_copy_address_wd = reg_wdata[31:0];
+  // R[intc_coalesce]: V(False)
 
-  assign interrupt_controler_enable_interrupt_we = addr_hit[11] & reg_we & !reg_error;
-  assign interrupt_controler_enable_interrupt_wd = reg_wdata[0];
+  //   F[threshold]: 7:0
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RW"),
+      .RESVAL  (8'h1)
+  ) u_intc_coalesce_threshold (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
 
-  assign interrupt_controler_status_interrupt_we = addr_hit[11] & reg_we & !reg_error;
-  assign interrupt_controler_status_interrupt_wd = reg_wdata[1];
+      // from register interface
+      .we(intc_coalesce_threshold_we),
+      .wd(intc_coalesce_threshold_wd),
 
-  assign initial_stack_addr_we = addr_hit[14] & reg_we & !reg_error;
-  assign initial_stack_addr_wd = reg_wdata[31:0];
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
 
-  // Read data return
-  always_comb begin
-    reg_rdata_next = '0;
-    unique case (1'b1)
-      addr_hit[0]: begin
-        reg_rdata_next[1:0] = safe_configuration_qs;
-      end
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.intc_coalesce.threshold.q),
 
-      addr_hit[1]: begin
-        reg_rdata_next[2:0] = dmr_mask_qs;
-      end
+      // to register interface (read)
+      .qs(intc_coalesce_threshold_qs)
+  );
 
-      addr_hit[2]: begin
-        reg_rdata_next[2:0] = master_core_qs;
-      end
 
-      addr_hit[3]: begin
-        reg_rdata_next[0] = critical_section_qs;
-      end
+  //   F[timeout]: 31:8
+  prim_subreg #(
+      .DW      (24),
+      .SWACCESS("RW"),
+      .RESVAL  (24'h0)
+  ) u_intc_coalesce_timeout (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
 
-      addr_hit[4]: begin
-        reg_rdata_next[0] = start_qs;
-      end
+      // from register interface
+      .we(intc_coalesce_timeout_we),
+      .wd(intc_coalesce_timeout_wd),
 
-      addr_hit[5]: begin
-        reg_rdata_next[31:0] = boot_address_qs;
-      end
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
 
-      addr_hit[6]: begin
-        reg_rdata_next[1:0] = external_debug_req_qs;
-      end
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.intc_coalesce.timeout.q),
 
-      addr_hit[7]: begin
-        reg_rdata_next[0] = initial_sync_master_qs;
-      end
+      // to register interface (read)
+      .qs(intc_coalesce_timeout_qs)
+  );
 
-      addr_hit[8]: begin
-        reg_rdata_next[0] = end_sw_routine_qs;
-      end
 
-      addr_hit[9]: begin
-        reg_rdata_next[31:0] = entry_address_qs;
-      end
+  // R[coalesced_jobs]: V(False)
 
-      addr_hit[10]: begin
-        reg_rdata_next[31:0] = safe_copy_address_qs;
-      end
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_coalesced_jobs (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
 
-      addr_hit[11]: begin
-        reg_rdata_next[0] = interrupt_controler_enable_interrupt_qs;
-        reg_rdata_next[1] = interrupt_controler_status_interrupt_qs;
-      end
+      .we(1'b0),
+      .wd('0),
 
-      addr_hit[12]: begin
-        reg_rdata_next[2:0] = cb_heep_status_cores_sleep_qs;
-        reg_rdata_next[5:3] = cb_heep_status_cores_debug_mode_qs;
-      end
+      // from internal hardware
+      .de(hw2reg.coalesced_jobs.de),
+      .d (hw2reg.coalesced_jobs.d),
 
-      addr_hit[13]: begin
-        reg_rdata_next[0] = dmr_rec_qs;
-      end
+      // to internal hardware
+      .qe(),
+      .q (),
 
-      addr_hit[14]: begin
-        reg_rdata_next[31:0] = initial_stack_addr_qs;
+      // to register interface (read)
+      .qs(coalesced_jobs_qs)
+  );
+
+
+  // R[warm_boot]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_warm_boot (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(warm_boot_we),
+      .wd(warm_boot_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(warm_boot_qs)
+  );
+
+
+  // R[warm_entry]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_warm_entry (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(warm_entry_we),
+      .wd(warm_entry_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(warm_entry_qs)
+  );
+
+
+  // R[warm_checksum]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_warm_checksum (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(warm_checksum_we),
+      .wd(warm_checksum_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(warm_checksum_qs)
+  );
+
+
+  // R[qos_priority]: V(False)
+
+  prim_subreg #(
+      .DW      (16),
+      .SWACCESS("RW"),
+      .RESVAL  (16'h0)
+  ) u_qos_priority (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(qos_priority_we),
+      .wd(qos_priority_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.qos_priority.q),
+
+      // to register interface (read)
+      .qs(qos_priority_qs)
+  );
+
+
+  // R[qos_weight]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_qos_weight (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(qos_weight_we),
+      .wd(qos_weight_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.qos_weight.q),
+
+      // to register interface (read)
+      .qs(qos_weight_qs)
+  );
+
+
+  // R[qos_bw_window]: V(False)
+
+  prim_subreg #(
+      .DW      (16),
+      .SWACCESS("RW"),
+      .RESVAL  (16'h0)
+  ) u_qos_bw_window (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(qos_bw_window_we),
+      .wd(qos_bw_window_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.qos_bw_window.q),
+
+      // to register interface (read)
+      .qs(qos_bw_window_qs)
+  );
+
+
+  // R[qos_bw_cap0]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_qos_bw_cap0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(qos_bw_cap0_we),
+      .wd(qos_bw_cap0_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.qos_bw_cap0.q),
+
+      // to register interface (read)
+      .qs(qos_bw_cap0_qs)
+  );
+
+
+  // R[qos_bw_cap1]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_qos_bw_cap1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(qos_bw_cap1_we),
+      .wd(qos_bw_cap1_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.qos_bw_cap1.q),
+
+      // to register interface (read)
+      .qs(qos_bw_cap1_qs)
+  );
+
+
+  // R[ecc_ctrl]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_ecc_ctrl (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(ecc_ctrl_we),
+      .wd(ecc_ctrl_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.ecc_ctrl.q),
+
+      // to register interface (read)
+      .qs(ecc_ctrl_qs)
+  );
+
+
+  // R[ecc_corrected]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_ecc_corrected (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.ecc_corrected.de),
+      .d (hw2reg.ecc_corrected.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(ecc_corrected_qs)
+  );
+
+
+  // R[ecc_uncorrected]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_ecc_uncorrected (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.ecc_uncorrected.de),
+      .d (hw2reg.ecc_uncorrected.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(ecc_uncorrected_qs)
+  );
+
+
+  // R[lockstep_ctrl]: V(False)
+
+  //   F[loose]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_lockstep_ctrl_loose (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(lockstep_ctrl_loose_we),
+      .wd(lockstep_ctrl_loose_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.lockstep_ctrl.loose.q),
+
+      // to register interface (read)
+      .qs(lockstep_ctrl_loose_qs)
+  );
+
+
+  //   F[delay]: 7:4
+  prim_subreg #(
+      .DW      (4),
+      .SWACCESS("RW"),
+      .RESVAL  (4'h1)
+  ) u_lockstep_ctrl_delay (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(lockstep_ctrl_delay_we),
+      .wd(lockstep_ctrl_delay_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.lockstep_ctrl.delay.q),
+
+      // to register interface (read)
+      .qs(lockstep_ctrl_delay_qs)
+  );
+
+
+  //   F[interval]: 31:8
+  prim_subreg #(
+      .DW      (24),
+      .SWACCESS("RW"),
+      .RESVAL  (24'h0)
+  ) u_lockstep_ctrl_interval (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(lockstep_ctrl_interval_we),
+      .wd(lockstep_ctrl_interval_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.lockstep_ctrl.interval.q),
+
+      // to register interface (read)
+      .qs(lockstep_ctrl_interval_qs)
+  );
+
+
+  // R[dmr_tiebreak]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_dmr_tiebreak (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(dmr_tiebreak_we),
+      .wd(dmr_tiebreak_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.dmr_tiebreak.q),
+
+      // to register interface (read)
+      .qs(dmr_tiebreak_qs)
+  );
+
+
+  // R[dmr_tiebreak_status]: V(False)
+
+  //   F[live]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RO"),
+      .RESVAL  (1'h0)
+  ) u_dmr_tiebreak_status_live (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.dmr_tiebreak_status.live.de),
+      .d (hw2reg.dmr_tiebreak_status.live.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(dmr_tiebreak_status_live_qs)
+  );
+
+
+  //   F[resolved]: 1:1
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RO"),
+      .RESVAL  (1'h0)
+  ) u_dmr_tiebreak_status_resolved (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.dmr_tiebreak_status.resolved.de),
+      .d (hw2reg.dmr_tiebreak_status.resolved.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(dmr_tiebreak_status_resolved_qs)
+  );
+
+
+  //   F[faulty]: 6:4
+  prim_subreg #(
+      .DW      (3),
+      .SWACCESS("RO"),
+      .RESVAL  (3'h0)
+  ) u_dmr_tiebreak_status_faulty (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.dmr_tiebreak_status.faulty.de),
+      .d (hw2reg.dmr_tiebreak_status.faulty.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(dmr_tiebreak_status_faulty_qs)
+  );
+
+
+  // R[dmr_checkpoint]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("WO"),
+      .RESVAL  (1'h0)
+  ) u_dmr_checkpoint (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(dmr_checkpoint_we),
+      .wd(dmr_checkpoint_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      .qs()
+  );
+
+
+  // R[tel_cnt_req]: V(False)
+
+  //   F[hart0]: 9:0
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_req_hart0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_req.hart0.de),
+      .d (hw2reg.tel_cnt_req.hart0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_req_hart0_qs)
+  );
+
+
+  //   F[hart1]: 19:10
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_req_hart1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_req.hart1.de),
+      .d (hw2reg.tel_cnt_req.hart1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_req_hart1_qs)
+  );
+
+
+  //   F[hart2]: 29:20
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_req_hart2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_req.hart2.de),
+      .d (hw2reg.tel_cnt_req.hart2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_req_hart2_qs)
+  );
+
+
+  // R[tel_cnt_addr]: V(False)
+
+  //   F[hart0]: 9:0
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_addr_hart0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_addr.hart0.de),
+      .d (hw2reg.tel_cnt_addr.hart0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_addr_hart0_qs)
+  );
+
+
+  //   F[hart1]: 19:10
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_addr_hart1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_addr.hart1.de),
+      .d (hw2reg.tel_cnt_addr.hart1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_addr_hart1_qs)
+  );
+
+
+  //   F[hart2]: 29:20
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_addr_hart2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_addr.hart2.de),
+      .d (hw2reg.tel_cnt_addr.hart2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_addr_hart2_qs)
+  );
+
+
+  // R[tel_cnt_we]: V(False)
+
+  //   F[hart0]: 9:0
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_we_hart0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_we.hart0.de),
+      .d (hw2reg.tel_cnt_we.hart0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_we_hart0_qs)
+  );
+
+
+  //   F[hart1]: 19:10
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_we_hart1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_we.hart1.de),
+      .d (hw2reg.tel_cnt_we.hart1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_we_hart1_qs)
+  );
+
+
+  //   F[hart2]: 29:20
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_we_hart2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_we.hart2.de),
+      .d (hw2reg.tel_cnt_we.hart2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_we_hart2_qs)
+  );
+
+
+  // R[tel_cnt_be]: V(False)
+
+  //   F[hart0]: 9:0
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_be_hart0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_be.hart0.de),
+      .d (hw2reg.tel_cnt_be.hart0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_be_hart0_qs)
+  );
+
+
+  //   F[hart1]: 19:10
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_be_hart1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_be.hart1.de),
+      .d (hw2reg.tel_cnt_be.hart1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_be_hart1_qs)
+  );
+
+
+  //   F[hart2]: 29:20
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_be_hart2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_be.hart2.de),
+      .d (hw2reg.tel_cnt_be.hart2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_be_hart2_qs)
+  );
+
+
+  // R[tel_cnt_wdata]: V(False)
+
+  //   F[hart0]: 9:0
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_wdata_hart0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_wdata.hart0.de),
+      .d (hw2reg.tel_cnt_wdata.hart0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_wdata_hart0_qs)
+  );
+
+
+  //   F[hart1]: 19:10
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_wdata_hart1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_wdata.hart1.de),
+      .d (hw2reg.tel_cnt_wdata.hart1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_wdata_hart1_qs)
+  );
+
+
+  //   F[hart2]: 29:20
+  prim_subreg #(
+      .DW      (10),
+      .SWACCESS("RO"),
+      .RESVAL  (10'h0)
+  ) u_tel_cnt_wdata_hart2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_cnt_wdata.hart2.de),
+      .d (hw2reg.tel_cnt_wdata.hart2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_cnt_wdata_hart2_qs)
+  );
+
+
+  // R[tel_ring_status]: V(False)
+
+  //   F[next]: 1:0
+  prim_subreg #(
+      .DW      (2),
+      .SWACCESS("RO"),
+      .RESVAL  (2'h0)
+  ) u_tel_ring_status_next (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_status.next.de),
+      .d (hw2reg.tel_ring_status.next.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_status_next_qs)
+  );
+
+
+  //   F[valid]: 7:4
+  prim_subreg #(
+      .DW      (4),
+      .SWACCESS("RO"),
+      .RESVAL  (4'h0)
+  ) u_tel_ring_status_valid (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_status.valid.de),
+      .d (hw2reg.tel_ring_status.valid.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_status_valid_qs)
+  );
+
+
+  // R[tel_ring_info]: V(False)
+
+  //   F[entry0]: 7:0
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_tel_ring_info_entry0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_info.entry0.de),
+      .d (hw2reg.tel_ring_info.entry0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_info_entry0_qs)
+  );
+
+
+  //   F[entry1]: 15:8
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_tel_ring_info_entry1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_info.entry1.de),
+      .d (hw2reg.tel_ring_info.entry1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_info_entry1_qs)
+  );
+
+
+  //   F[entry2]: 23:16
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_tel_ring_info_entry2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_info.entry2.de),
+      .d (hw2reg.tel_ring_info.entry2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_info_entry2_qs)
+  );
+
+
+  //   F[entry3]: 31:24
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_tel_ring_info_entry3 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_info.entry3.de),
+      .d (hw2reg.tel_ring_info.entry3.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_info_entry3_qs)
+  );
+
+
+  // R[tel_ring_addr0]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_addr0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_addr0.de),
+      .d (hw2reg.tel_ring_addr0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_addr0_qs)
+  );
+
+
+  // R[tel_ring_addr1]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_addr1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_addr1.de),
+      .d (hw2reg.tel_ring_addr1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_addr1_qs)
+  );
+
+
+  // R[tel_ring_addr2]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_addr2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_addr2.de),
+      .d (hw2reg.tel_ring_addr2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_addr2_qs)
+  );
+
+
+  // R[tel_ring_addr3]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_addr3 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_addr3.de),
+      .d (hw2reg.tel_ring_addr3.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_addr3_qs)
+  );
+
+
+  // R[tel_ring_time0]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_time0 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_time0.de),
+      .d (hw2reg.tel_ring_time0.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_time0_qs)
+  );
+
+
+  // R[tel_ring_time1]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_time1 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_time1.de),
+      .d (hw2reg.tel_ring_time1.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_time1_qs)
+  );
+
+
+  // R[tel_ring_time2]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_time2 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_time2.de),
+      .d (hw2reg.tel_ring_time2.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_time2_qs)
+  );
+
+
+  // R[tel_ring_time3]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_tel_ring_time3 (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tel_ring_time3.de),
+      .d (hw2reg.tel_ring_time3.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tel_ring_time3_qs)
+  );
+
+
+  // R[tel_clear]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("WO"),
+      .RESVAL  (1'h0)
+  ) u_tel_clear (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(tel_clear_we),
+      .wd(tel_clear_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(reg2hw.tel_clear.qe),
+      .q (reg2hw.tel_clear.q),
+
+      .qs()
+  );
+
+
+  // R[tmr_failover]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_tmr_failover (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(tmr_failover_we),
+      .wd(tmr_failover_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.tmr_failover.q),
+
+      // to register interface (read)
+      .qs(tmr_failover_qs)
+  );
+
+
+  // R[tmr_failover_status]: V(False)
+
+  //   F[count]: 7:0
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_tmr_failover_status_count (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tmr_failover_status.count.de),
+      .d (hw2reg.tmr_failover_status.count.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tmr_failover_status_count_qs)
+  );
+
+
+  //   F[faulty]: 10:8
+  prim_subreg #(
+      .DW      (3),
+      .SWACCESS("RO"),
+      .RESVAL  (3'h0)
+  ) u_tmr_failover_status_faulty (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.tmr_failover_status.faulty.de),
+      .d (hw2reg.tmr_failover_status.faulty.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(tmr_failover_status_faulty_qs)
+  );
+
+
+  // R[sync_ctrl]: V(False)
+
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_sync_ctrl (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(sync_ctrl_we),
+      .wd(sync_ctrl_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.sync_ctrl.q),
+
+      // to register interface (read)
+      .qs(sync_ctrl_qs)
+  );
+
+
+  // R[sync_latency]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_sync_latency (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.sync_latency.de),
+      .d (hw2reg.sync_latency.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(sync_latency_qs)
+  );
+
+
+  // R[check_policy]: V(False)
+
+  //   F[stores]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_check_policy_stores (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(check_policy_stores_we),
+      .wd(check_policy_stores_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.check_policy.stores.q),
+
+      // to register interface (read)
+      .qs(check_policy_stores_qs)
+  );
+
+
+  //   F[sample]: 1:1
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_check_policy_sample (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(check_policy_sample_we),
+      .wd(check_policy_sample_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.check_policy.sample.q),
+
+      // to register interface (read)
+      .qs(check_policy_sample_qs)
+  );
+
+
+  //   F[nth]: 15:8
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RW"),
+      .RESVAL  (8'h0)
+  ) u_check_policy_nth (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(check_policy_nth_we),
+      .wd(check_policy_nth_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.check_policy.nth.q),
+
+      // to register interface (read)
+      .qs(check_policy_nth_qs)
+  );
+
+
+
+
+  logic [54:0] addr_hit;
+  always_comb begin
+    addr_hit = '0;
+    addr_hit[0] = (reg_addr == SAFE_WRAPPER_CTRL_SAFE_CONFIGURATION_OFFSET);
+    addr_hit[1] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_MASK_OFFSET);
+    addr_hit[2] = (reg_addr == SAFE_WRAPPER_CTRL_MASTER_CORE_OFFSET);
+    addr_hit[3] = (reg_addr == SAFE_WRAPPER_CTRL_CRITICAL_SECTION_OFFSET);
+    addr_hit[4] = (reg_addr == SAFE_WRAPPER_CTRL_START_OFFSET);
+    addr_hit[5] = (reg_addr == SAFE_WRAPPER_CTRL_BOOT_ADDRESS_OFFSET);
+    addr_hit[6] = (reg_addr == SAFE_WRAPPER_CTRL_EXTERNAL_DEBUG_REQ_OFFSET);
+    addr_hit[7] = (reg_addr == SAFE_WRAPPER_CTRL_INITIAL_SYNC_MASTER_OFFSET);
+    addr_hit[8] = (reg_addr == SAFE_WRAPPER_CTRL_END_SW_ROUTINE_OFFSET);
+    addr_hit[9] = (reg_addr == SAFE_WRAPPER_CTRL_ENTRY_ADDRESS_OFFSET);
+    addr_hit[10] = (reg_addr == SAFE_WRAPPER_CTRL_SAFE_COPY_ADDRESS_OFFSET);
+    addr_hit[11] = (reg_addr == SAFE_WRAPPER_CTRL_INTERRUPT_CONTROLER_OFFSET);
+    addr_hit[12] = (reg_addr == SAFE_WRAPPER_CTRL_CB_HEEP_STATUS_OFFSET);
+    addr_hit[13] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_REC_OFFSET);
+    addr_hit[14] = (reg_addr == SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR_OFFSET);
+    addr_hit[15] = (reg_addr == SAFE_WRAPPER_CTRL_EXIT_STATUS_OFFSET);
+    addr_hit[16] = (reg_addr == SAFE_WRAPPER_CTRL_CYCLE_COUNT_OFFSET);
+    addr_hit[17] = (reg_addr == SAFE_WRAPPER_CTRL_INTC_COALESCE_OFFSET);
+    addr_hit[18] = (reg_addr == SAFE_WRAPPER_CTRL_COALESCED_JOBS_OFFSET);
+    addr_hit[19] = (reg_addr == SAFE_WRAPPER_CTRL_WARM_BOOT_OFFSET);
+    addr_hit[20] = (reg_addr == SAFE_WRAPPER_CTRL_WARM_ENTRY_OFFSET);
+    addr_hit[21] = (reg_addr == SAFE_WRAPPER_CTRL_WARM_CHECKSUM_OFFSET);
+    addr_hit[22] = (reg_addr == SAFE_WRAPPER_CTRL_QOS_PRIORITY_OFFSET);
+    addr_hit[23] = (reg_addr == SAFE_WRAPPER_CTRL_QOS_WEIGHT_OFFSET);
+    addr_hit[24] = (reg_addr == SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_OFFSET);
+    addr_hit[25] = (reg_addr == SAFE_WRAPPER_CTRL_QOS_BW_CAP0_OFFSET);
+    addr_hit[26] = (reg_addr == SAFE_WRAPPER_CTRL_QOS_BW_CAP1_OFFSET);
+    addr_hit[27] = (reg_addr == SAFE_WRAPPER_CTRL_ECC_CTRL_OFFSET);
+    addr_hit[28] = (reg_addr == SAFE_WRAPPER_CTRL_ECC_CORRECTED_OFFSET);
+    addr_hit[29] = (reg_addr == SAFE_WRAPPER_CTRL_ECC_UNCORRECTED_OFFSET);
+    addr_hit[30] = (reg_addr == SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_OFFSET);
+    addr_hit[31] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_TIEBREAK_OFFSET);
+    addr_hit[32] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_OFFSET);
+    addr_hit[33] = (reg_addr == SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_OFFSET);
+    addr_hit[34] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CNT_REQ_OFFSET);
+    addr_hit[35] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_OFFSET);
+    addr_hit[36] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CNT_WE_OFFSET);
+    addr_hit[37] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CNT_BE_OFFSET);
+    addr_hit[38] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_OFFSET);
+    addr_hit[39] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_STATUS_OFFSET);
+    addr_hit[40] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_INFO_OFFSET);
+    addr_hit[41] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_ADDR0_OFFSET);
+    addr_hit[42] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_ADDR1_OFFSET);
+    addr_hit[43] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_ADDR2_OFFSET);
+    addr_hit[44] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_ADDR3_OFFSET);
+    addr_hit[45] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_TIME0_OFFSET);
+    addr_hit[46] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_TIME1_OFFSET);
+    addr_hit[47] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_TIME2_OFFSET);
+    addr_hit[48] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_RING_TIME3_OFFSET);
+    addr_hit[49] = (reg_addr == SAFE_WRAPPER_CTRL_TEL_CLEAR_OFFSET);
+    addr_hit[50] = (reg_addr == SAFE_WRAPPER_CTRL_TMR_FAILOVER_OFFSET);
+    addr_hit[51] = (reg_addr == SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_OFFSET);
+    addr_hit[52] = (reg_addr == SAFE_WRAPPER_CTRL_SYNC_CTRL_OFFSET);
+    addr_hit[53] = (reg_addr == SAFE_WRAPPER_CTRL_SYNC_LATENCY_OFFSET);
+    addr_hit[54] = (reg_addr == SAFE_WRAPPER_CTRL_CHECK_POLICY_OFFSET);
+  end
+
+  assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0;
+
+  // Check sub-word write is permitted
+  always_comb begin
+    wr_err = (reg_we &
+              ((addr_hit[ 0] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 0] & ~reg_be))) |
+               (addr_hit[ 1] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 1] & ~reg_be))) |
+               (addr_hit[ 2] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 2] & ~reg_be))) |
+               (addr_hit[ 3] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 3] & ~reg_be))) |
+               (addr_hit[ 4] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 4] & ~reg_be))) |
+               (addr_hit[ 5] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 5] & ~reg_be))) |
+               (addr_hit[ 6] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 6] & ~reg_be))) |
+               (addr_hit[ 7] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 7] & ~reg_be))) |
+               (addr_hit[ 8] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 8] & ~reg_be))) |
+               (addr_hit[ 9] & (|(SAFE_WRAPPER_CTRL_PERMIT[ 9] & ~reg_be))) |
+               (addr_hit[10] & (|(SAFE_WRAPPER_CTRL_PERMIT[10] & ~reg_be))) |
+               (addr_hit[11] & (|(SAFE_WRAPPER_CTRL_PERMIT[11] & ~reg_be))) |
+               (addr_hit[12] & (|(SAFE_WRAPPER_CTRL_PERMIT[12] & ~reg_be))) |
+               (addr_hit[13] & (|(SAFE_WRAPPER_CTRL_PERMIT[13] & ~reg_be))) |
+               (addr_hit[14] & (|(SAFE_WRAPPER_CTRL_PERMIT[14] & ~reg_be))) |
+               (addr_hit[15] & (|(SAFE_WRAPPER_CTRL_PERMIT[15] & ~reg_be))) |
+               (addr_hit[16] & (|(SAFE_WRAPPER_CTRL_PERMIT[16] & ~reg_be))) |
+               (addr_hit[17] & (|(SAFE_WRAPPER_CTRL_PERMIT[17] & ~reg_be))) |
+               (addr_hit[18] & (|(SAFE_WRAPPER_CTRL_PERMIT[18] & ~reg_be))) |
+               (addr_hit[19] & (|(SAFE_WRAPPER_CTRL_PERMIT[19] & ~reg_be))) |
+               (addr_hit[20] & (|(SAFE_WRAPPER_CTRL_PERMIT[20] & ~reg_be))) |
+               (addr_hit[21] & (|(SAFE_WRAPPER_CTRL_PERMIT[21] & ~reg_be))) |
+               (addr_hit[22] & (|(SAFE_WRAPPER_CTRL_PERMIT[22] & ~reg_be))) |
+               (addr_hit[23] & (|(SAFE_WRAPPER_CTRL_PERMIT[23] & ~reg_be))) |
+               (addr_hit[24] & (|(SAFE_WRAPPER_CTRL_PERMIT[24] & ~reg_be))) |
+               (addr_hit[25] & (|(SAFE_WRAPPER_CTRL_PERMIT[25] & ~reg_be))) |
+               (addr_hit[26] & (|(SAFE_WRAPPER_CTRL_PERMIT[26] & ~reg_be))) |
+               (addr_hit[27] & (|(SAFE_WRAPPER_CTRL_PERMIT[27] & ~reg_be))) |
+               (addr_hit[28] & (|(SAFE_WRAPPER_CTRL_PERMIT[28] & ~reg_be))) |
+               (addr_hit[29] & (|(SAFE_WRAPPER_CTRL_PERMIT[29] & ~reg_be))) |
+               (addr_hit[30] & (|(SAFE_WRAPPER_CTRL_PERMIT[30] & ~reg_be))) |
+               (addr_hit[31] & (|(SAFE_WRAPPER_CTRL_PERMIT[31] & ~reg_be))) |
+               (addr_hit[32] & (|(SAFE_WRAPPER_CTRL_PERMIT[32] & ~reg_be))) |
+               (addr_hit[33] & (|(SAFE_WRAPPER_CTRL_PERMIT[33] & ~reg_be))) |
+               (addr_hit[34] & (|(SAFE_WRAPPER_CTRL_PERMIT[34] & ~reg_be))) |
+               (addr_hit[35] & (|(SAFE_WRAPPER_CTRL_PERMIT[35] & ~reg_be))) |
+               (addr_hit[36] & (|(SAFE_WRAPPER_CTRL_PERMIT[36] & ~reg_be))) |
+               (addr_hit[37] & (|(SAFE_WRAPPER_CTRL_PERMIT[37] & ~reg_be))) |
+               (addr_hit[38] & (|(SAFE_WRAPPER_CTRL_PERMIT[38] & ~reg_be))) |
+               (addr_hit[39] & (|(SAFE_WRAPPER_CTRL_PERMIT[39] & ~reg_be))) |
+               (addr_hit[40] & (|(SAFE_WRAPPER_CTRL_PERMIT[40] & ~reg_be))) |
+               (addr_hit[41] & (|(SAFE_WRAPPER_CTRL_PERMIT[41] & ~reg_be))) |
+               (addr_hit[42] & (|(SAFE_WRAPPER_CTRL_PERMIT[42] & ~reg_be))) |
+               (addr_hit[43] & (|(SAFE_WRAPPER_CTRL_PERMIT[43] & ~reg_be))) |
+               (addr_hit[44] & (|(SAFE_WRAPPER_CTRL_PERMIT[44] & ~reg_be))) |
+               (addr_hit[45] & (|(SAFE_WRAPPER_CTRL_PERMIT[45] & ~reg_be))) |
+               (addr_hit[46] & (|(SAFE_WRAPPER_CTRL_PERMIT[46] & ~reg_be))) |
+               (addr_hit[47] & (|(SAFE_WRAPPER_CTRL_PERMIT[47] & ~reg_be))) |
+               (addr_hit[48] & (|(SAFE_WRAPPER_CTRL_PERMIT[48] & ~reg_be))) |
+               (addr_hit[49] & (|(SAFE_WRAPPER_CTRL_PERMIT[49] & ~reg_be))) |
+               (addr_hit[50] & (|(SAFE_WRAPPER_CTRL_PERMIT[50] & ~reg_be))) |
+               (addr_hit[51] & (|(SAFE_WRAPPER_CTRL_PERMIT[51] & ~reg_be))) |
+               (addr_hit[52] & (|(SAFE_WRAPPER_CTRL_PERMIT[52] & ~reg_be))) |
+               (addr_hit[53] & (|(SAFE_WRAPPER_CTRL_PERMIT[53] & ~reg_be))) |
+               (addr_hit[54] & (|(SAFE_WRAPPER_CTRL_PERMIT[54] & ~reg_be)))));
+  end
+
+  assign safe_configuration_we = addr_hit[0] & reg_we & !reg_error;
+  assign safe_configuration_wd = reg_wdata[1:0];
+
+  assign dmr_mask_we = addr_hit[1] & reg_we & !reg_error;
+  assign dmr_mask_wd = reg_wdata[2:0];
+
+  assign master_core_we = addr_hit[2] & reg_we & !reg_error;
+  assign master_core_wd = reg_wdata[2:0];
+
+  assign critical_section_we = addr_hit[3] & reg_we & !reg_error;
+  assign critical_section_wd = reg_wdata[0];
+
+  assign start_we = addr_hit[4] & reg_we & !reg_error;
+  assign start_wd = reg_wdata[0];
+
+  assign boot_address_we = addr_hit[5] & reg_we & !reg_error;
+  assign boot_address_wd = reg_wdata[31:0];
+
+  assign initial_sync_master_we = addr_hit[7] & reg_we & !reg_error;
+  assign initial_sync_master_wd = reg_wdata[0];
+
+  assign end_sw_routine_we = addr_hit[8] & reg_we & !reg_error;
+  assign end_sw_routine_wd = reg_wdata[0];
+
+  assign entry_address_we = addr_hit[9] & reg_we & !reg_error;
+  assign entry_address_wd = reg_wdata[31:0];
+
+  assign safe_copy_address_we = addr_hit[10] & reg_we & !reg_error;
+  assign safe_copy_address_wd = reg_wdata[31:0];
+
+  assign interrupt_controler_enable_interrupt_we = addr_hit[11] & reg_we & !reg_error;
+  assign interrupt_controler_enable_interrupt_wd = reg_wdata[0];
+
+  assign interrupt_controler_status_interrupt_we = addr_hit[11] & reg_we & !reg_error;
+  assign interrupt_controler_status_interrupt_wd = reg_wdata[1];
+
+  assign initial_stack_addr_we = addr_hit[14] & reg_we & !reg_error;
+  assign initial_stack_addr_wd = reg_wdata[31:0];
+
+  assign exit_status_we = addr_hit[15] & reg_we & !reg_error;
+  assign exit_status_wd = reg_wdata[31:0];
+
+  assign intc_coalesce_threshold_we = addr_hit[17] & reg_we & !reg_error;
+  assign intc_coalesce_threshold_wd = reg_wdata[7:0];
+
+  assign intc_coalesce_timeout_we = addr_hit[17] & reg_we & !reg_error;
+  assign intc_coalesce_timeout_wd = reg_wdata[31:8];
+
+  assign warm_boot_we = addr_hit[19] & reg_we & !reg_error;
+  assign warm_boot_wd = reg_wdata[0];
+
+  assign warm_entry_we = addr_hit[20] & reg_we & !reg_error;
+  assign warm_entry_wd = reg_wdata[31:0];
+
+  assign warm_checksum_we = addr_hit[21] & reg_we & !reg_error;
+  assign warm_checksum_wd = reg_wdata[31:0];
+
+  assign qos_priority_we = addr_hit[22] & reg_we & !reg_error;
+  assign qos_priority_wd = reg_wdata[15:0];
+
+  assign qos_weight_we = addr_hit[23] & reg_we & !reg_error;
+  assign qos_weight_wd = reg_wdata[31:0];
+
+  assign qos_bw_window_we = addr_hit[24] & reg_we & !reg_error;
+  assign qos_bw_window_wd = reg_wdata[15:0];
+
+  assign qos_bw_cap0_we = addr_hit[25] & reg_we & !reg_error;
+  assign qos_bw_cap0_wd = reg_wdata[31:0];
+
+  assign qos_bw_cap1_we = addr_hit[26] & reg_we & !reg_error;
+  assign qos_bw_cap1_wd = reg_wdata[31:0];
+
+  assign ecc_ctrl_we = addr_hit[27] & reg_we & !reg_error;
+  assign ecc_ctrl_wd = reg_wdata[0];
+
+  assign lockstep_ctrl_loose_we = addr_hit[30] & reg_we & !reg_error;
+  assign lockstep_ctrl_loose_wd = reg_wdata[0];
+
+  assign lockstep_ctrl_delay_we = addr_hit[30] & reg_we & !reg_error;
+  assign lockstep_ctrl_delay_wd = reg_wdata[7:4];
+
+  assign lockstep_ctrl_interval_we = addr_hit[30] & reg_we & !reg_error;
+  assign lockstep_ctrl_interval_wd = reg_wdata[31:8];
+
+  assign dmr_tiebreak_we = addr_hit[31] & reg_we & !reg_error;
+  assign dmr_tiebreak_wd = reg_wdata[0];
+
+  assign dmr_checkpoint_we = addr_hit[33] & reg_we & !reg_error;
+  assign dmr_checkpoint_wd = reg_wdata[0];
+
+  assign tel_clear_we = addr_hit[49] & reg_we & !reg_error;
+  assign tel_clear_wd = reg_wdata[0];
+
+  assign tmr_failover_we = addr_hit[50] & reg_we & !reg_error;
+  assign tmr_failover_wd = reg_wdata[0];
+
+  assign sync_ctrl_we = addr_hit[52] & reg_we & !reg_error;
+  assign sync_ctrl_wd = reg_wdata[0];
+
+  assign check_policy_stores_we = addr_hit[54] & reg_we & !reg_error;
+  assign check_policy_stores_wd = reg_wdata[0];
+
+  assign check_policy_sample_we = addr_hit[54] & reg_we & !reg_error;
+  assign check_policy_sample_wd = reg_wdata[1];
+
+  assign check_policy_nth_we = addr_hit[54] & reg_we & !reg_error;
+  assign check_policy_nth_wd = reg_wdata[15:8];
+
+  // Read data return
+  always_comb begin
+    reg_rdata_next = '0;
+    unique case (1'b1)
+      addr_hit[0]: begin
+        reg_rdata_next[1:0] = safe_configuration_qs;
+      end
+
+      addr_hit[1]: begin
+        reg_rdata_next[2:0] = dmr_mask_qs;
+      end
+
+      addr_hit[2]: begin
+        reg_rdata_next[2:0] = master_core_qs;
+      end
+
+      addr_hit[3]: begin
+        reg_rdata_next[0] = critical_section_qs;
+      end
+
+      addr_hit[4]: begin
+        reg_rdata_next[0] = start_qs;
+      end
+
+      addr_hit[5]: begin
+        reg_rdata_next[31:0] = boot_address_qs;
+      end
+
+      addr_hit[6]: begin
+        reg_rdata_next[1:0] = external_debug_req_qs;
+      end
+
+      addr_hit[7]: begin
+        reg_rdata_next[0] = initial_sync_master_qs;
+      end
+
+      addr_hit[8]: begin
+        reg_rdata_next[0] = end_sw_routine_qs;
+      end
+
+      addr_hit[9]: begin
+        reg_rdata_next[31:0] = entry_address_qs;
+      end
+
+      addr_hit[10]: begin
+        reg_rdata_next[31:0] = safe_copy_address_qs;
+      end
+
+      addr_hit[11]: begin
+        reg_rdata_next[0] = interrupt_controler_enable_interrupt_qs;
+        reg_rdata_next[1] = interrupt_controler_status_interrupt_qs;
+      end
+
+      addr_hit[12]: begin
+        reg_rdata_next[2:0] = cb_heep_status_cores_sleep_qs;
+        reg_rdata_next[5:3] = cb_heep_status_cores_debug_mode_qs;
+      end
+
+      addr_hit[13]: begin
+        reg_rdata_next[0] = dmr_rec_qs;
+      end
+
+      addr_hit[14]: begin
+        reg_rdata_next[31:0] = initial_stack_addr_qs;
+      end
+
+      addr_hit[15]: begin
+        reg_rdata_next[31:0] = exit_status_qs;
+      end
+
+      addr_hit[16]: begin
+        reg_rdata_next[31:0] = cycle_count_qs;
+      end
+
+      addr_hit[17]: begin
+        reg_rdata_next[7:0] = intc_coalesce_threshold_qs;
+        reg_rdata_next[31:8] = intc_coalesce_timeout_qs;
+      end
+
+      addr_hit[18]: begin
+        reg_rdata_next[7:0] = coalesced_jobs_qs;
+      end
+
+      addr_hit[19]: begin
+        reg_rdata_next[0] = warm_boot_qs;
+      end
+
+      addr_hit[20]: begin
+        reg_rdata_next[31:0] = warm_entry_qs;
+      end
+
+      addr_hit[21]: begin
+        reg_rdata_next[31:0] = warm_checksum_qs;
+      end
+
+      addr_hit[22]: begin
+        reg_rdata_next[15:0] = qos_priority_qs;
+      end
+
+      addr_hit[23]: begin
+        reg_rdata_next[31:0] = qos_weight_qs;
+      end
+
+      addr_hit[24]: begin
+        reg_rdata_next[15:0] = qos_bw_window_qs;
+      end
+
+      addr_hit[25]: begin
+        reg_rdata_next[31:0] = qos_bw_cap0_qs;
+      end
+
+      addr_hit[26]: begin
+        reg_rdata_next[31:0] = qos_bw_cap1_qs;
+      end
+
+      addr_hit[27]: begin
+        reg_rdata_next[0] = ecc_ctrl_qs;
+      end
+
+      addr_hit[28]: begin
+        reg_rdata_next[31:0] = ecc_corrected_qs;
+      end
+
+      addr_hit[29]: begin
+        reg_rdata_next[31:0] = ecc_uncorrected_qs;
+      end
+
+      addr_hit[30]: begin
+        reg_rdata_next[0] = lockstep_ctrl_loose_qs;
+        reg_rdata_next[7:4] = lockstep_ctrl_delay_qs;
+        reg_rdata_next[31:8] = lockstep_ctrl_interval_qs;
+      end
+
+      addr_hit[31]: begin
+        reg_rdata_next[0] = dmr_tiebreak_qs;
+      end
+
+      addr_hit[32]: begin
+        reg_rdata_next[0] = dmr_tiebreak_status_live_qs;
+        reg_rdata_next[1] = dmr_tiebreak_status_resolved_qs;
+        reg_rdata_next[6:4] = dmr_tiebreak_status_faulty_qs;
+      end
+
+      addr_hit[33]: begin
+        reg_rdata_next[0] = '0;
+      end
+
+      addr_hit[34]: begin
+        reg_rdata_next[9:0] = tel_cnt_req_hart0_qs;
+        reg_rdata_next[19:10] = tel_cnt_req_hart1_qs;
+        reg_rdata_next[29:20] = tel_cnt_req_hart2_qs;
+      end
+
+      addr_hit[35]: begin
+        reg_rdata_next[9:0] = tel_cnt_addr_hart0_qs;
+        reg_rdata_next[19:10] = tel_cnt_addr_hart1_qs;
+        reg_rdata_next[29:20] = tel_cnt_addr_hart2_qs;
+      end
+
+      addr_hit[36]: begin
+        reg_rdata_next[9:0] = tel_cnt_we_hart0_qs;
+        reg_rdata_next[19:10] = tel_cnt_we_hart1_qs;
+        reg_rdata_next[29:20] = tel_cnt_we_hart2_qs;
+      end
+
+      addr_hit[37]: begin
+        reg_rdata_next[9:0] = tel_cnt_be_hart0_qs;
+        reg_rdata_next[19:10] = tel_cnt_be_hart1_qs;
+        reg_rdata_next[29:20] = tel_cnt_be_hart2_qs;
+      end
+
+      addr_hit[38]: begin
+        reg_rdata_next[9:0] = tel_cnt_wdata_hart0_qs;
+        reg_rdata_next[19:10] = tel_cnt_wdata_hart1_qs;
+        reg_rdata_next[29:20] = tel_cnt_wdata_hart2_qs;
+      end
+
+      addr_hit[39]: begin
+        reg_rdata_next[1:0] = tel_ring_status_next_qs;
+        reg_rdata_next[7:4] = tel_ring_status_valid_qs;
+      end
+
+      addr_hit[40]: begin
+        reg_rdata_next[7:0] = tel_ring_info_entry0_qs;
+        reg_rdata_next[15:8] = tel_ring_info_entry1_qs;
+        reg_rdata_next[23:16] = tel_ring_info_entry2_qs;
+        reg_rdata_next[31:24] = tel_ring_info_entry3_qs;
+      end
+
+      addr_hit[41]: begin
+        reg_rdata_next[31:0] = tel_ring_addr0_qs;
+      end
+
+      addr_hit[42]: begin
+        reg_rdata_next[31:0] = tel_ring_addr1_qs;
+      end
+
+      addr_hit[43]: begin
+        reg_rdata_next[31:0] = tel_ring_addr2_qs;
+      end
+
+      addr_hit[44]: begin
+        reg_rdata_next[31:0] = tel_ring_addr3_qs;
+      end
+
+      addr_hit[45]: begin
+        reg_rdata_next[31:0] = tel_ring_time0_qs;
+      end
+
+      addr_hit[46]: begin
+        reg_rdata_next[31:0] = tel_ring_time1_qs;
+      end
+
+      addr_hit[47]: begin
+        reg_rdata_next[31:0] = tel_ring_time2_qs;
+      end
+
+      addr_hit[48]: begin
+        reg_rdata_next[31:0] = tel_ring_time3_qs;
+      end
+
+      addr_hit[49]: begin
+        reg_rdata_next[0] = '0;
+      end
+
+      addr_hit[50]: begin
+        reg_rdata_next[0] = tmr_failover_qs;
+      end
+
+      addr_hit[51]: begin
+        reg_rdata_next[7:0] = tmr_failover_status_count_qs;
+        reg_rdata_next[10:8] = tmr_failover_status_faulty_qs;
+      end
+
+      addr_hit[52]: begin
+        reg_rdata_next[0] = sync_ctrl_qs;
+      end
+
+      addr_hit[53]: begin
+        reg_rdata_next[31:0] = sync_latency_qs;
+      end
+
+      addr_hit[54]: begin
+        reg_rdata_next[0] = check_policy_stores_qs;
+        reg_rdata_next[1] = check_policy_sample_qs;
+        reg_rdata_next[15:8] = check_policy_nth_qs;
       end
 
       default: begin
@@ -738,7 +2798,7 @@ module safe_wrapper_ctrl_reg_top #(
 endmodule
 
 module safe_wrapper_ctrl_reg_top_intf #(
-    parameter  int AW = 6,
+    parameter  int AW = 8,
     localparam int DW = 32
 ) (
     input logic clk_i,
@@ -0,0 +1,52 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// OBI port of CB_boot_rom for instruction fetch. Granted in the same cycle
+// and answered in the next one, with several requests in flight, so the
+// boot/halt/resync code runs at full fetch rate instead of going through
+// periph_to_reg. Writes are acknowledged and dropped.
+
+module sap_boot_rom
+  import reg_pkg::*;
+#(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input  obi_req_t  req_i,
+    output obi_resp_t resp_o
+);
+
+  reg_req_t rom_req;
+  reg_rsp_t rom_rsp;
+  logic valid_q;
+  logic [31:0] rdata_q;
+
+  always_comb begin
+    rom_req       = '0;
+    rom_req.valid = req_i.req;
+    rom_req.addr  = req_i.addr;
+  end
+
+  CB_boot_rom CB_boot_rom_i (
+      .reg_req_i(rom_req),
+      .reg_rsp_o(rom_rsp)
+  );
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      valid_q <= 1'b0;
+      rdata_q <= '0;
+    end else begin
+      valid_q <= req_i.req;
+      if (req_i.req) rdata_q <= rom_rsp.rdata;
+    end
+  end
+
+  assign resp_o = '{gnt: req_i.req, rvalid: valid_q, rdata: rdata_q};
+
+endmodule
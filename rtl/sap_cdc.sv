@@ -0,0 +1,179 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Host <-> core clock domain boundary used by the top wrappers.
+// CDC = 1: OBI ports through obi_cdc (cdc_fifo_gray), CSR through reg_cdc
+// (cdc_2phase), level signals through sync and the interrupt pulse through
+// edge_propagator. The core reset is rst_ni synchronized to core_clk_i.
+// CDC = 0: everything is passed through and core_clk_i is ignored.
+
+module sap_cdc
+  import reg_pkg::*;
+#(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter CDC       = 1,
+    parameter NSLEEP    = 3,
+    parameter LOG_DEPTH = 2
+) (
+    // Host domain
+    input logic host_clk_i,
+    input logic host_rst_ni,
+    input logic host_en_i,
+
+    input  obi_req_t  host_master_req_i,
+    output obi_resp_t host_master_resp_o,
+
+    output obi_req_t  host_slave_req_o,
+    input  obi_resp_t host_slave_resp_i,
+
+    input  reg_req_t host_csr_req_i,
+    output reg_rsp_t host_csr_resp_o,
+
+    input  logic              host_debug_req_i,
+    output logic [NSLEEP-1:0] host_sleep_o,
+    output logic              host_interrupt_o,
+
+    // Core domain
+    input  logic core_clk_i,
+    output logic core_clk_o,
+    output logic core_rst_no,
+    output logic core_en_o,
+
+    output obi_req_t  core_master_req_o,
+    input  obi_resp_t core_master_resp_i,
+
+    input  obi_req_t  core_slave_req_i,
+    output obi_resp_t core_slave_resp_o,
+
+    output reg_req_t core_csr_req_o,
+    input  reg_rsp_t core_csr_resp_i,
+
+    output logic              core_debug_req_o,
+    input  logic [NSLEEP-1:0] core_sleep_i,
+    input  logic              core_interrupt_i
+);
+
+  if (CDC) begin : gen_cdc
+
+    assign core_clk_o = core_clk_i;
+
+    rstgen core_rstgen_i (
+        .clk_i      (core_clk_i),
+        .rst_ni     (host_rst_ni),
+        .test_mode_i(1'b0),
+        .rst_no     (core_rst_no),
+        .init_no    ()
+    );
+
+    //Host master -> core
+    obi_cdc #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t),
+        .LOG_DEPTH (LOG_DEPTH)
+    ) master_cdc_i (
+        .src_clk_i (host_clk_i),
+        .src_rst_ni(host_rst_ni),
+        .src_req_i (host_master_req_i),
+        .src_resp_o(host_master_resp_o),
+        .dst_clk_i (core_clk_i),
+        .dst_rst_ni(core_rst_no),
+        .dst_req_o (core_master_req_o),
+        .dst_resp_i(core_master_resp_i)
+    );
+
+    //Core external slave -> host
+    obi_cdc #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t),
+        .LOG_DEPTH (LOG_DEPTH)
+    ) slave_cdc_i (
+        .src_clk_i (core_clk_i),
+        .src_rst_ni(core_rst_no),
+        .src_req_i (core_slave_req_i),
+        .src_resp_o(core_slave_resp_o),
+        .dst_clk_i (host_clk_i),
+        .dst_rst_ni(host_rst_ni),
+        .dst_req_o (host_slave_req_o),
+        .dst_resp_i(host_slave_resp_i)
+    );
+
+    //CSR
+    reg_cdc #(
+        .req_t(reg_req_t),
+        .rsp_t(reg_rsp_t)
+    ) csr_cdc_i (
+        .src_clk_i (host_clk_i),
+        .src_rst_ni(host_rst_ni),
+        .src_req_i (host_csr_req_i),
+        .src_rsp_o (host_csr_resp_o),
+        .dst_clk_i (core_clk_i),
+        .dst_rst_ni(core_rst_no),
+        .dst_req_o (core_csr_req_o),
+        .dst_rsp_i (core_csr_resp_i)
+    );
+
+    //Level signals
+    sync #(
+        .STAGES(2)
+    ) en_sync_i (
+        .clk_i   (core_clk_i),
+        .rst_ni  (core_rst_no),
+        .serial_i(host_en_i),
+        .serial_o(core_en_o)
+    );
+
+    sync #(
+        .STAGES(2)
+    ) debug_req_sync_i (
+        .clk_i   (core_clk_i),
+        .rst_ni  (core_rst_no),
+        .serial_i(host_debug_req_i),
+        .serial_o(core_debug_req_o)
+    );
+
+    for (genvar i = 0; i < NSLEEP; i++) begin : gen_sleep_sync
+      sync #(
+          .STAGES(2)
+      ) sleep_sync_i (
+          .clk_i   (host_clk_i),
+          .rst_ni  (host_rst_ni),
+          .serial_i(core_sleep_i[i]),
+          .serial_o(host_sleep_o[i])
+      );
+    end
+
+    //Interrupt is a single cycle pulse
+    edge_propagator interrupt_cdc_i (
+        .clk_tx_i (core_clk_i),
+        .rstn_tx_i(core_rst_no),
+        .edge_i   (core_interrupt_i),
+        .clk_rx_i (host_clk_i),
+        .rstn_rx_i(host_rst_ni),
+        .edge_o   (host_interrupt_o)
+    );
+
+  end else begin : gen_no_cdc
+
+    assign core_clk_o         = host_clk_i;
+    assign core_rst_no        = host_rst_ni;
+    assign core_en_o          = host_en_i;
+
+    assign core_master_req_o  = host_master_req_i;
+    assign host_master_resp_o = core_master_resp_i;
+
+    assign host_slave_req_o   = core_slave_req_i;
+    assign core_slave_resp_o  = host_slave_resp_i;
+
+    assign core_csr_req_o     = host_csr_req_i;
+    assign host_csr_resp_o    = core_csr_resp_i;
+
+    assign core_debug_req_o   = host_debug_req_i;
+    assign host_sleep_o       = core_sleep_i;
+    assign host_interrupt_o   = core_interrupt_i;
+
+  end
+
+endmodule
@@ -0,0 +1,248 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// NCLUSTERS sap_top instances behind a single external master / CSR port.
+//  - Memory: cluster k at GLOBAL_BASE_ADDRESS + k*CLUSTER_MEM_STRIDE, the
+//    address is rebased to the cluster internal map. Unmapped addresses go to
+//    an error slave (writes dropped, reads return ERROR_START_ADDRESS).
+//  - CSR: cluster k at SAFE_CSR_BASE_ADDRESS + k*CLUSTER_CSR_STRIDE, job
+//    dispatcher at DISPATCHER_START_ADDRESS.
+//  - External slave ports of the clusters are arbitrated to one port.
+
+module sap_cluster_array
+  import reg_pkg::*;
+  import sap_pkg::*;
+#(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter NCLUSTERS   = 2,
+    parameter NHARTS      = sap_pkg::NHARTS,
+    parameter N_BANKS     = sap_pkg::NUM_BANKS,
+    parameter QUEUE_DEPTH = 4
+) (
+    // Clock and Reset
+    input logic clk_i,
+    input logic rst_ni,
+
+    //Bus External Master
+    input  obi_req_t  ext_master_req_i,
+    output obi_resp_t ext_master_resp_o,
+
+    //Bus External Slave
+    output obi_req_t  ext_slave_req_o,
+    input  obi_resp_t ext_slave_resp_i,
+
+    //CSR
+    input  reg_req_t csr_reg_req_i,
+    output reg_rsp_t csr_reg_resp_o,
+
+    // Debug Interface
+    input  logic                        debug_req_i,
+    output logic [NCLUSTERS*NHARTS-1:0] sleep_o,
+
+    // power manager signals that goes to the ASIC macros
+    input  logic [NCLUSTERS*N_BANKS-1:0] pwrgate_ni,
+    output logic [NCLUSTERS*N_BANKS-1:0] pwrgate_ack_no,
+    input  logic [NCLUSTERS*N_BANKS-1:0] set_retentive_ni,
+
+    // Interrupt Interface
+    output logic interrupt_o
+);
+
+  localparam int unsigned CsrPorts = NCLUSTERS + 1;
+  localparam int unsigned LogCsrPorts = $clog2(CsrPorts);
+  localparam logic [31:0] DispatcherIdx = NCLUSTERS;
+  localparam logic [31:0] ErrorIdx = NCLUSTERS;
+  localparam int unsigned LogMemPorts = cf_math_pkg::idx_width(NCLUSTERS + 1);
+
+  if (NCLUSTERS > sap_pkg::MAX_CLUSTERS) begin : gen_nclusters_error
+    $error("sap_cluster_array: NCLUSTERS must not exceed MAX_CLUSTERS");
+  end
+
+  //Signals
+  obi_req_t  [NCLUSTERS:0] cluster_master_req;  //[ErrorIdx] error slave
+  obi_resp_t [NCLUSTERS:0] cluster_master_resp;
+  logic error_rvalid_q;
+  obi_req_t  [NCLUSTERS-1:0] cluster_slave_req;
+  obi_resp_t [NCLUSTERS-1:0] cluster_slave_resp;
+
+  reg_req_t [CsrPorts-1:0] host_csr_req;
+  reg_rsp_t [CsrPorts-1:0] host_csr_rsp;
+  reg_req_t [NCLUSTERS-1:0] dispatch_csr_req;
+  reg_rsp_t [NCLUSTERS-1:0] dispatch_csr_rsp;
+  reg_req_t [NCLUSTERS-1:0] cluster_csr_req;
+  reg_rsp_t [NCLUSTERS-1:0] cluster_csr_rsp;
+
+  logic [NCLUSTERS-1:0][NHARTS-1:0] cluster_sleep;
+  logic [NCLUSTERS-1:0] cluster_intr;
+
+  logic [LogCsrPorts-1:0] csr_select;
+
+  addr_map_rule_pkg::addr_map_rule_t [NCLUSTERS-1:0] mem_rules;
+  addr_map_rule_pkg::addr_map_rule_t [CsrPorts-1:0] csr_rules;
+
+  for (genvar i = 0; i < NCLUSTERS; i++) begin : gen_rules
+    assign mem_rules[i] = '{
+            idx: i,
+            start_addr: GLOBAL_BASE_ADDRESS + i * CLUSTER_MEM_STRIDE,
+            end_addr: GLOBAL_BASE_ADDRESS + (i + 1) * CLUSTER_MEM_STRIDE
+        };
+    assign csr_rules[i] = '{
+            idx: i,
+            start_addr: SAFE_CSR_BASE_ADDRESS + i * CLUSTER_CSR_STRIDE,
+            end_addr: SAFE_CSR_BASE_ADDRESS + (i + 1) * CLUSTER_CSR_STRIDE
+        };
+  end
+  assign csr_rules[NCLUSTERS] = '{
+          idx: DispatcherIdx,
+          start_addr: DISPATCHER_START_ADDRESS,
+          end_addr: DISPATCHER_END_ADDRESS
+      };
+
+  //***Memory: External Master -> Cluster[k]***//
+  sap_xbar_varlat_one_to_n #(
+      .obi_req_t  (obi_req_t),
+      .obi_resp_t (obi_resp_t),
+      .XBAR_NSLAVE(NCLUSTERS + 1),
+      .NUM_RULES  (NCLUSTERS)
+  ) cluster_demux_i (
+      .clk_i,
+      .rst_ni,
+      .addr_map_i   (mem_rules),
+      .default_idx_i(ErrorIdx[LogMemPorts-1:0]),
+      .master_req_i (ext_master_req_i),
+      .master_resp_o(ext_master_resp_o),
+      .slave_req_o  (cluster_master_req),
+      .slave_resp_i (cluster_master_resp)
+  );
+
+  //Error slave: grants every request and answers it on the next cycle
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) error_rvalid_q <= 1'b0;
+    else error_rvalid_q <= cluster_master_req[ErrorIdx].req;
+  end
+
+  always_comb begin
+    cluster_master_resp[ErrorIdx]        = '0;
+    cluster_master_resp[ErrorIdx].gnt    = cluster_master_req[ErrorIdx].req;
+    cluster_master_resp[ErrorIdx].rvalid = error_rvalid_q;
+    cluster_master_resp[ErrorIdx].rdata  = ERROR_START_ADDRESS;
+  end
+
+  //***External slave: Cluster[k] -> External Slave***//
+  sap_xbar_varlat_n_to_one #(
+      .obi_req_t   (obi_req_t),
+      .obi_resp_t  (obi_resp_t),
+      .XBAR_NMASTER(NCLUSTERS)
+  ) ext_slave_mux_i (
+      .clk_i,
+      .rst_ni,
+      .rr_i('0),
+      .master_req_i (cluster_slave_req),
+      .master_resp_o(cluster_slave_resp),
+      .slave_req_o  (ext_slave_req_o),
+      .slave_resp_i (ext_slave_resp_i)
+  );
+
+  //***CSR: Host -> Cluster[k] / Dispatcher***//
+  addr_decode #(
+      .NoIndices(CsrPorts),
+      .NoRules(CsrPorts),
+      .addr_t(logic [31:0]),
+      .rule_t(addr_map_rule_pkg::addr_map_rule_t)
+  ) i_addr_decode_cluster_csr (
+      .addr_i(csr_reg_req_i.addr),
+      .addr_map_i(csr_rules),
+      .idx_o(csr_select),
+      .dec_valid_o(),
+      .dec_error_o(),
+      .en_default_idx_i(1'b0),
+      .default_idx_i('0)
+  );
+
+  reg_demux #(
+      .NoPorts(CsrPorts),
+      .req_t  (reg_pkg::reg_req_t),
+      .rsp_t  (reg_pkg::reg_rsp_t)
+  ) reg_demux_i (
+      .clk_i,
+      .rst_ni,
+      .in_select_i(csr_select),
+      .in_req_i(csr_reg_req_i),
+      .in_rsp_o(csr_reg_resp_o),
+      .out_req_o(host_csr_req),
+      .out_rsp_i(host_csr_rsp)
+  );
+
+  sap_dispatcher #(
+      .reg_req_t  (reg_pkg::reg_req_t),
+      .reg_rsp_t  (reg_pkg::reg_rsp_t),
+      .NCLUSTERS  (NCLUSTERS),
+      .NHARTS     (NHARTS),
+      .QUEUE_DEPTH(QUEUE_DEPTH)
+  ) sap_dispatcher_i (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i(host_csr_req[DispatcherIdx]),
+      .reg_rsp_o(host_csr_rsp[DispatcherIdx]),
+      .sleep_i(cluster_sleep),
+      .cluster_csr_req_o(dispatch_csr_req),
+      .cluster_csr_rsp_i(dispatch_csr_rsp)
+  );
+
+  //Clusters
+  for (genvar i = 0; i < NCLUSTERS; i++) begin : gen_cluster
+    obi_req_t cluster_master_rebased_req;
+
+    //Rebase to the cluster internal address map
+    always_comb begin
+      cluster_master_rebased_req = cluster_master_req[i];
+      cluster_master_rebased_req.addr = cluster_master_req[i].addr - i * CLUSTER_MEM_STRIDE;
+    end
+
+    //Host and dispatcher share the cluster CSR port
+    reg_mux #(
+        .NoPorts(2),
+        .AW(32),
+        .DW(32),
+        .req_t(reg_pkg::reg_req_t),
+        .rsp_t(reg_pkg::reg_rsp_t)
+    ) reg_mux_i (
+        .clk_i,
+        .rst_ni,
+        .in_req_i ({dispatch_csr_req[i], host_csr_req[i]}),
+        .in_rsp_o ({dispatch_csr_rsp[i], host_csr_rsp[i]}),
+        .out_req_o(cluster_csr_req[i]),
+        .out_rsp_i(cluster_csr_rsp[i])
+    );
+
+    sap_top #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t),
+        .NHARTS    (NHARTS),
+        .N_BANKS   (N_BANKS)
+    ) sap_top_i (
+        .clk_i,
+        .rst_ni,
+        .ext_master_req_i(cluster_master_rebased_req),
+        .ext_master_resp_o(cluster_master_resp[i]),
+        .ext_slave_req_o(cluster_slave_req[i]),
+        .ext_slave_resp_i(cluster_slave_resp[i]),
+        .csr_reg_req_i(cluster_csr_req[i]),
+        .csr_reg_resp_o(cluster_csr_rsp[i]),
+        .debug_req_i,
+        .pwrgate_ni(pwrgate_ni[i*N_BANKS+:N_BANKS]),
+        .pwrgate_ack_no(pwrgate_ack_no[i*N_BANKS+:N_BANKS]),
+        .set_retentive_ni(set_retentive_ni[i*N_BANKS+:N_BANKS]),
+        .sleep_o(cluster_sleep[i]),
+        .interrupt_o(cluster_intr[i])
+    );
+
+    assign sleep_o[i*NHARTS+:NHARTS] = cluster_sleep[i];
+  end
+
+  assign interrupt_o = |cluster_intr;
+
+endmodule
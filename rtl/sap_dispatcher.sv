@@ -0,0 +1,213 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Job dispatcher for sap_cluster_array.
+// Jobs (entry addresses) written to JOB_SUBMIT are queued and launched on the
+// next idle cluster (round robin) by writing its ENTRY_ADDRESS and START
+// registers. A cluster is idle when all its harts sleep and no dispatched job
+// is in flight; a job is done when the cluster wakes up and goes back to sleep.
+
+module sap_dispatcher #(
+    parameter type reg_req_t = logic,
+    parameter type reg_rsp_t = logic,
+    parameter NCLUSTERS   = 2,
+    parameter NHARTS      = sap_pkg::NHARTS,
+    parameter QUEUE_DEPTH = 4
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    // Bus Interface
+    input  reg_req_t reg_req_i,
+    output reg_rsp_t reg_rsp_o,
+
+    // Cluster status
+    input logic [NCLUSTERS-1:0][NHARTS-1:0] sleep_i,
+
+    // Cluster CSR masters
+    output reg_req_t [NCLUSTERS-1:0] cluster_csr_req_o,
+    input  reg_rsp_t [NCLUSTERS-1:0] cluster_csr_rsp_i
+);
+
+  import sap_dispatcher_reg_pkg::*;
+  import safe_wrapper_ctrl_reg_pkg::*;
+
+  localparam int unsigned LogNClusters = NCLUSTERS > 1 ? $clog2(NCLUSTERS) : 32'd1;
+
+  //CLUSTER_MASK and CLUSTERS_IDLE hold MAX_CLUSTERS bits
+  if (NCLUSTERS > sap_pkg::MAX_CLUSTERS) begin : gen_nclusters_error
+    $error("sap_dispatcher: NCLUSTERS must not exceed MAX_CLUSTERS");
+  end
+
+  sap_dispatcher_reg2hw_t reg2hw;
+  sap_dispatcher_hw2reg_t hw2reg;
+
+  sap_dispatcher_reg_top #(
+      .reg_req_t(reg_req_t),
+      .reg_rsp_t(reg_rsp_t)
+  ) sap_dispatcher_reg_top_i (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i,
+      .reg_rsp_o,
+      .reg2hw,
+      .hw2reg,
+      .devmode_i(1'b1)
+  );
+
+  typedef enum logic [1:0] {
+    IDLE,
+    WRITE_ENTRY,
+    WRITE_START
+  } dispatch_state_e;
+
+  dispatch_state_e state_q, state_d;
+
+  //Job queue
+  logic queue_full, queue_empty, queue_pop;
+  logic [31:0] job_entry;
+
+  fifo_v3 #(
+      .DATA_WIDTH(32),
+      .DEPTH     (QUEUE_DEPTH)
+  ) job_queue_i (
+      .clk_i,
+      .rst_ni,
+      .flush_i   (1'b0),
+      .testmode_i(1'b0),
+      .full_o    (queue_full),
+      .empty_o   (queue_empty),
+      .usage_o   (),
+      .data_i    (reg2hw.job_submit.q),
+      .push_i    (reg2hw.job_submit.qe & ~queue_full),
+      .data_o    (job_entry),
+      .pop_i     (queue_pop)
+  );
+
+  //Cluster state
+  logic [NCLUSTERS-1:0] cluster_sleep, cluster_idle;
+  logic [NCLUSTERS-1:0] busy_q, woke_q;
+  logic [NCLUSTERS-1:0] job_done;
+  logic [7:0] idle_status;
+
+  logic [LogNClusters-1:0] rr_q, sel_q, sel_d;
+  logic sel_valid;
+
+  logic [31:0] jobs_dispatched_q, jobs_done_q;
+
+  for (genvar i = 0; i < NCLUSTERS; i++) begin : gen_cluster_state
+    assign cluster_sleep[i] = &sleep_i[i];
+    assign cluster_idle[i] = cluster_sleep[i] & ~busy_q[i] & reg2hw.ctrl.cluster_mask.q[i];
+    assign job_done[i] = busy_q[i] & woke_q[i] & cluster_sleep[i];
+  end
+
+  //Round robin search from the cluster after the last one used
+  always_comb begin
+    logic [LogNClusters:0] idx;
+    sel_d = rr_q;
+    sel_valid = 1'b0;
+    for (int unsigned k = 0; k < NCLUSTERS; k++) begin
+      idx = rr_q + k;
+      if (idx >= NCLUSTERS) idx = idx - NCLUSTERS;
+      if (!sel_valid && cluster_idle[idx[LogNClusters-1:0]]) begin
+        sel_d = idx[LogNClusters-1:0];
+        sel_valid = 1'b1;
+      end
+    end
+  end
+
+  //CSR master
+  always_comb begin
+    cluster_csr_req_o = '0;
+    unique case (state_q)
+      WRITE_ENTRY: begin
+        cluster_csr_req_o[sel_q].valid = 1'b1;
+        cluster_csr_req_o[sel_q].write = 1'b1;
+        cluster_csr_req_o[sel_q].wstrb = 4'b1111;
+        cluster_csr_req_o[sel_q].addr  = 32'(SAFE_WRAPPER_CTRL_ENTRY_ADDRESS_OFFSET);
+        cluster_csr_req_o[sel_q].wdata = job_entry;
+      end
+      WRITE_START: begin
+        cluster_csr_req_o[sel_q].valid = 1'b1;
+        cluster_csr_req_o[sel_q].write = 1'b1;
+        cluster_csr_req_o[sel_q].wstrb = 4'b1111;
+        cluster_csr_req_o[sel_q].addr  = 32'(SAFE_WRAPPER_CTRL_START_OFFSET);
+        cluster_csr_req_o[sel_q].wdata = 32'h1;
+      end
+      default: ;
+    endcase
+  end
+
+  //FSM
+  always_comb begin
+    state_d   = state_q;
+    queue_pop = 1'b0;
+    unique case (state_q)
+      IDLE: begin
+        if (reg2hw.ctrl.enable.q && !queue_empty && sel_valid) state_d = WRITE_ENTRY;
+      end
+      WRITE_ENTRY: begin
+        if (cluster_csr_rsp_i[sel_q].ready) state_d = WRITE_START;
+      end
+      WRITE_START: begin
+        if (cluster_csr_rsp_i[sel_q].ready) begin
+          state_d   = IDLE;
+          queue_pop = 1'b1;
+        end
+      end
+      default: state_d = IDLE;
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      state_q           <= IDLE;
+      rr_q              <= '0;
+      sel_q             <= '0;
+      busy_q            <= '0;
+      woke_q            <= '0;
+      jobs_dispatched_q <= '0;
+      jobs_done_q       <= '0;
+    end else begin
+      state_q <= state_d;
+      if (state_q == IDLE && state_d == WRITE_ENTRY) sel_q <= sel_d;
+
+      for (int unsigned i = 0; i < NCLUSTERS; i++) begin
+        if (job_done[i]) begin
+          busy_q[i] <= 1'b0;
+          woke_q[i] <= 1'b0;
+        end else if (busy_q[i] && !cluster_sleep[i]) begin
+          woke_q[i] <= 1'b1;
+        end
+      end
+
+      if (queue_pop) begin
+        busy_q[sel_q] <= 1'b1;
+        rr_q <= (sel_q == NCLUSTERS - 1) ? '0 : sel_q + 1'b1;
+        jobs_dispatched_q <= jobs_dispatched_q + 32'd1;
+      end
+      jobs_done_q <= jobs_done_q + 32'($countones(job_done));
+    end
+  end
+
+  //Status
+  always_comb begin
+    idle_status = '0;
+    idle_status[NCLUSTERS-1:0] = cluster_idle;
+  end
+
+  assign hw2reg.status.queue_full.d = queue_full;
+  assign hw2reg.status.queue_full.de = 1'b1;
+  assign hw2reg.status.queue_empty.d = queue_empty;
+  assign hw2reg.status.queue_empty.de = 1'b1;
+  assign hw2reg.status.clusters_idle.d = idle_status;
+  assign hw2reg.status.clusters_idle.de = 1'b1;
+
+  assign hw2reg.jobs_dispatched.d = jobs_dispatched_q;
+  assign hw2reg.jobs_dispatched.de = 1'b1;
+  assign hw2reg.jobs_done.d = jobs_done_q;
+  assign hw2reg.jobs_done.de = 1'b1;
+
+endmodule : sap_dispatcher
@@ -0,0 +1,424 @@
+// Copyright lowRISC contributors.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Register Top module auto-generated by `reggen`
+
+
+`include "common_cells/assertions.svh"
+
+module sap_dispatcher_reg_top #(
+    parameter type reg_req_t = logic,
+    parameter type reg_rsp_t = logic,
+    parameter int AW = 5
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    input reg_req_t reg_req_i,
+    output reg_rsp_t reg_rsp_o,
+    // To HW
+    output sap_dispatcher_reg_pkg::sap_dispatcher_reg2hw_t reg2hw,  // Write
+    input sap_dispatcher_reg_pkg::sap_dispatcher_hw2reg_t hw2reg,  // Read
+
+
+    // Config
+    input devmode_i  // If 1, explicit error return for unmapped register access
+);
+
+  import sap_dispatcher_reg_pkg::*;
+
+  localparam int DW = 32;
+  localparam int DBW = DW / 8;  // Byte Width
+
+  // register signals
+  logic           reg_we;
+  logic           reg_re;
+  logic [ AW-1:0] reg_addr;
+  logic [ DW-1:0] reg_wdata;
+  logic [DBW-1:0] reg_be;
+  logic [ DW-1:0] reg_rdata;
+  logic           reg_error;
+
+  logic addrmiss, wr_err;
+
+  logic [DW-1:0] reg_rdata_next;
+
+  // Below register interface can be changed
+  reg_req_t reg_intf_req;
+  reg_rsp_t reg_intf_rsp;
+
+
+  assign reg_intf_req = reg_req_i;
+  assign reg_rsp_o = reg_intf_rsp;
+
+
+  assign reg_we = reg_intf_req.valid & reg_intf_req.write;
+  assign reg_re = reg_intf_req.valid & ~reg_intf_req.write;
+  assign reg_addr = reg_intf_req.addr;
+  assign reg_wdata = reg_intf_req.wdata;
+  assign reg_be = reg_intf_req.wstrb;
+  assign reg_intf_rsp.rdata = reg_rdata;
+  assign reg_intf_rsp.error = reg_error;
+  assign reg_intf_rsp.ready = 1'b1;
+
+  assign reg_rdata = reg_rdata_next;
+  assign reg_error = (devmode_i & addrmiss) | wr_err;
+
+
+  // Define SW related signals
+  // Format: <reg>_<field>_{wd|we|qs}
+  //        or <reg>_{wd|we|qs} if field == 1 or 0
+  logic ctrl_enable_qs;
+  logic ctrl_enable_wd;
+  logic ctrl_enable_we;
+  logic [7:0] ctrl_cluster_mask_qs;
+  logic [7:0] ctrl_cluster_mask_wd;
+  logic ctrl_cluster_mask_we;
+  logic [31:0] job_submit_wd;
+  logic job_submit_we;
+  logic status_queue_full_qs;
+  logic status_queue_empty_qs;
+  logic [7:0] status_clusters_idle_qs;
+  logic [31:0] jobs_dispatched_qs;
+  logic [31:0] jobs_done_qs;
+
+  // Register instances
+  // R[ctrl]: V(False)
+
+  //   F[enable]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h1)
+  ) u_ctrl_enable (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(ctrl_enable_we),
+      .wd(ctrl_enable_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.ctrl.enable.q),
+
+      // to register interface (read)
+      .qs(ctrl_enable_qs)
+  );
+
+
+  //   F[cluster_mask]: 15:8
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RW"),
+      .RESVAL  (8'hff)
+  ) u_ctrl_cluster_mask (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(ctrl_cluster_mask_we),
+      .wd(ctrl_cluster_mask_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.ctrl.cluster_mask.q),
+
+      // to register interface (read)
+      .qs(ctrl_cluster_mask_qs)
+  );
+
+
+  // R[job_submit]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("WO"),
+      .RESVAL  (32'h0)
+  ) u_job_submit (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(job_submit_we),
+      .wd(job_submit_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(reg2hw.job_submit.qe),
+      .q (reg2hw.job_submit.q),
+
+      .qs()
+  );
+
+
+  // R[status]: V(False)
+
+  //   F[queue_full]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RO"),
+      .RESVAL  (1'h0)
+  ) u_status_queue_full (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.status.queue_full.de),
+      .d (hw2reg.status.queue_full.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(status_queue_full_qs)
+  );
+
+
+  //   F[queue_empty]: 1:1
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RO"),
+      .RESVAL  (1'h1)
+  ) u_status_queue_empty (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.status.queue_empty.de),
+      .d (hw2reg.status.queue_empty.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(status_queue_empty_qs)
+  );
+
+
+  //   F[clusters_idle]: 15:8
+  prim_subreg #(
+      .DW      (8),
+      .SWACCESS("RO"),
+      .RESVAL  (8'h0)
+  ) u_status_clusters_idle (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.status.clusters_idle.de),
+      .d (hw2reg.status.clusters_idle.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(status_clusters_idle_qs)
+  );
+
+
+  // R[jobs_dispatched]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_jobs_dispatched (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.jobs_dispatched.de),
+      .d (hw2reg.jobs_dispatched.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(jobs_dispatched_qs)
+  );
+
+
+  // R[jobs_done]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RO"),
+      .RESVAL  (32'h0)
+  ) u_jobs_done (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.jobs_done.de),
+      .d (hw2reg.jobs_done.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(jobs_done_qs)
+  );
+
+
+
+
+  logic [4:0] addr_hit;
+  always_comb begin
+    addr_hit = '0;
+    addr_hit[0] = (reg_addr == SAP_DISPATCHER_CTRL_OFFSET);
+    addr_hit[1] = (reg_addr == SAP_DISPATCHER_JOB_SUBMIT_OFFSET);
+    addr_hit[2] = (reg_addr == SAP_DISPATCHER_STATUS_OFFSET);
+    addr_hit[3] = (reg_addr == SAP_DISPATCHER_JOBS_DISPATCHED_OFFSET);
+    addr_hit[4] = (reg_addr == SAP_DISPATCHER_JOBS_DONE_OFFSET);
+  end
+
+  assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0;
+
+  // Check sub-word write is permitted
+  always_comb begin
+    wr_err = (reg_we &
+              ((addr_hit[0] & (|(SAP_DISPATCHER_PERMIT[0] & ~reg_be))) |
+               (addr_hit[1] & (|(SAP_DISPATCHER_PERMIT[1] & ~reg_be))) |
+               (addr_hit[2] & (|(SAP_DISPATCHER_PERMIT[2] & ~reg_be))) |
+               (addr_hit[3] & (|(SAP_DISPATCHER_PERMIT[3] & ~reg_be))) |
+               (addr_hit[4] & (|(SAP_DISPATCHER_PERMIT[4] & ~reg_be)))));
+  end
+
+  assign ctrl_enable_we = addr_hit[0] & reg_we & !reg_error;
+  assign ctrl_enable_wd = reg_wdata[0];
+
+  assign ctrl_cluster_mask_we = addr_hit[0] & reg_we & !reg_error;
+  assign ctrl_cluster_mask_wd = reg_wdata[15:8];
+
+  assign job_submit_we = addr_hit[1] & reg_we & !reg_error;
+  assign job_submit_wd = reg_wdata[31:0];
+
+  // Read data return
+  always_comb begin
+    reg_rdata_next = '0;
+    unique case (1'b1)
+      addr_hit[0]: begin
+        reg_rdata_next[0] = ctrl_enable_qs;
+        reg_rdata_next[15:8] = ctrl_cluster_mask_qs;
+      end
+
+      addr_hit[1]: begin
+        reg_rdata_next[31:0] = '0;
+      end
+
+      addr_hit[2]: begin
+        reg_rdata_next[0] = status_queue_full_qs;
+        reg_rdata_next[1] = status_queue_empty_qs;
+        reg_rdata_next[15:8] = status_clusters_idle_qs;
+      end
+
+      addr_hit[3]: begin
+        reg_rdata_next[31:0] = jobs_dispatched_qs;
+      end
+
+      addr_hit[4]: begin
+        reg_rdata_next[31:0] = jobs_done_qs;
+      end
+
+      default: begin
+        reg_rdata_next = '1;
+      end
+    endcase
+  end
+
+  // Unused signal tieoff
+
+  // wdata / byte enable are not always fully used
+  // add a blanket unused statement to handle lint waivers
+  logic unused_wdata;
+  logic unused_be;
+  assign unused_wdata = ^reg_wdata;
+  assign unused_be = ^reg_be;
+
+  // Assertions for Register Interface
+  `ASSERT(en2addrHit, (reg_we || reg_re) |-> $onehot0(addr_hit))
+
+endmodule
+
+module sap_dispatcher_reg_top_intf #(
+    parameter  int AW = 5,
+    localparam int DW = 32
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    REG_BUS.in regbus_slave,
+    // To HW
+    output sap_dispatcher_reg_pkg::sap_dispatcher_reg2hw_t reg2hw,  // Write
+    input sap_dispatcher_reg_pkg::sap_dispatcher_hw2reg_t hw2reg,  // Read
+    // Config
+    input devmode_i  // If 1, explicit error return for unmapped register access
+);
+  localparam int unsigned STRB_WIDTH = DW / 8;
+
+  `include "register_interface/typedef.svh"
+  `include "register_interface/assign.svh"
+
+  // Define structs for reg_bus
+  typedef logic [AW-1:0] addr_t;
+  typedef logic [DW-1:0] data_t;
+  typedef logic [STRB_WIDTH-1:0] strb_t;
+  `REG_BUS_TYPEDEF_ALL(reg_bus, addr_t, data_t, strb_t)
+
+  reg_bus_req_t s_reg_req;
+  reg_bus_rsp_t s_reg_rsp;
+
+  // Assign SV interface to structs
+  `REG_BUS_ASSIGN_TO_REQ(s_reg_req, regbus_slave)
+  `REG_BUS_ASSIGN_FROM_RSP(regbus_slave, s_reg_rsp)
+
+
+
+  sap_dispatcher_reg_top #(
+      .reg_req_t(reg_bus_req_t),
+      .reg_rsp_t(reg_bus_rsp_t),
+      .AW(AW)
+  ) i_regs (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i(s_reg_req),
+      .reg_rsp_o(s_reg_rsp),
+      .reg2hw,  // Write
+      .hw2reg,  // Read
+      .devmode_i
+  );
+
+endmodule
+
+
@@ -0,0 +1,276 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// DMA engine, master of the system crossbar.
+// Word based 1D/2D copy. When a transfer ends and NEXT_DESC != 0 the next
+// descriptor is fetched from memory, same layout as the first 7 registers:
+//   0x00 SRC_ADDR / 0x04 DST_ADDR / 0x08 D1_LEN / 0x0c D2_LEN
+//   0x10 SRC_STRIDE / 0x14 DST_STRIDE / 0x18 NEXT_DESC
+// Rows are copied in bursts of up to BURST words: the reads are issued back to
+// back (the xbar keeps them in order), then the writes from the burst buffer.
+// The descriptor words are fetched the same way.
+
+module sap_dma #(
+    parameter type reg_req_t  = logic,
+    parameter type reg_rsp_t  = logic,
+    parameter type obi_req_t  = logic,
+    parameter type obi_resp_t = logic
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    // Bus Interface
+    input  reg_req_t reg_req_i,
+    output reg_rsp_t reg_rsp_o,
+
+    // OBI Master
+    output obi_req_t  dma_master_req_o,
+    input  obi_resp_t dma_master_resp_i,
+
+    // Interrupt end of chain, start pulse to route it to the programming hart
+    output logic dma_intr_o,
+    output logic dma_start_o
+);
+
+  import sap_dma_reg_pkg::*;
+
+  localparam int unsigned DESC_WORDS = 7;
+  localparam int unsigned BURST = sap_pkg::XBAR_MAX_OUTSTANDING;
+  localparam int unsigned CntWidth = $clog2((BURST > DESC_WORDS ? BURST : DESC_WORDS) + 1);
+
+  sap_dma_reg2hw_t reg2hw;
+  sap_dma_hw2reg_t hw2reg;
+
+  sap_dma_reg_top #(
+      .reg_req_t(reg_req_t),
+      .reg_rsp_t(reg_rsp_t)
+  ) sap_dma_reg_top_i (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i,
+      .reg_rsp_o,
+      .reg2hw,
+      .hw2reg,
+      .devmode_i(1'b1)
+  );
+
+  typedef enum logic [2:0] {
+    IDLE,
+    READ,
+    READ_WAIT,
+    WRITE,
+    WRITE_WAIT,
+    DESC_READ,
+    DESC_WAIT
+  } dma_state_e;
+
+  dma_state_e state_q, state_d;
+
+  //Working descriptor
+  logic [31:0] src_row_q, dst_row_q;
+  logic [31:0] src_ptr_q, dst_ptr_q;
+  logic [15:0] d1_len_q, d2_len_q;
+  logic [31:0] src_stride_q, dst_stride_q;
+  logic [31:0] next_desc_q;
+
+  logic [15:0] d1_cnt_q, d2_cnt_q;
+  logic [BURST-1:0][31:0] data_q;
+
+  //Requests granted / responses received in the current burst or descriptor fetch
+  logic [CntWidth-1:0] req_cnt_q, rsp_cnt_q;
+
+  logic start_s;
+  logic [15:0] d1_rem_s;
+  logic [CntWidth-1:0] burst_len_s, phase_len_s;
+  logic last_req_s, last_rsp_s;
+  logic last_burst_s, last_row_s;
+  logic desc_phase_s, read_phase_s;
+  logic done_s;
+
+  assign start_s = reg2hw.ctrl.start.q && (state_q == IDLE);
+  assign dma_start_o = start_s;
+
+  assign d1_rem_s = d1_len_q - d1_cnt_q;
+  assign last_burst_s = (d1_rem_s <= 16'(BURST));
+  assign burst_len_s = last_burst_s ? CntWidth'(d1_rem_s) : CntWidth'(BURST);
+  assign last_row_s = (d2_len_q == 16'd0) || (d2_cnt_q == d2_len_q - 16'd1);
+
+  assign desc_phase_s = (state_q == DESC_READ) || (state_q == DESC_WAIT);
+  assign read_phase_s = (state_q == READ) || (state_q == READ_WAIT);
+  assign phase_len_s = desc_phase_s ? CntWidth'(DESC_WORDS) : burst_len_s;
+  assign last_req_s = dma_master_resp_i.gnt && (req_cnt_q == phase_len_s - 1'b1);
+  assign last_rsp_s = dma_master_resp_i.rvalid && (rsp_cnt_q == phase_len_s - 1'b1);
+
+  //Start is cleared once the first descriptor is latched
+  assign hw2reg.ctrl.start.d = 1'b0;
+  assign hw2reg.ctrl.start.de = start_s;
+
+  assign hw2reg.status.busy.d = (state_q != IDLE) || reg2hw.ctrl.start.q;
+  assign hw2reg.status.busy.de = 1'b1;
+
+  assign hw2reg.status.done.d = 1'b1;
+  assign hw2reg.status.done.de = done_s;
+
+  assign dma_intr_o = reg2hw.ctrl.irq_en.q & reg2hw.status.done.q;
+
+  //OBI Master
+  always_comb begin
+    dma_master_req_o       = '0;
+    dma_master_req_o.be    = 4'b1111;
+    dma_master_req_o.wdata = data_q[req_cnt_q];
+    unique case (state_q)
+      READ: begin
+        dma_master_req_o.req  = 1'b1;
+        dma_master_req_o.addr = src_ptr_q + {req_cnt_q, 2'b00};
+      end
+      WRITE: begin
+        dma_master_req_o.req  = 1'b1;
+        dma_master_req_o.we   = 1'b1;
+        dma_master_req_o.addr = dst_ptr_q + {req_cnt_q, 2'b00};
+      end
+      DESC_READ: begin
+        dma_master_req_o.req  = 1'b1;
+        dma_master_req_o.addr = next_desc_q + {req_cnt_q, 2'b00};
+      end
+      default: ;
+    endcase
+  end
+
+  //FSM
+  always_comb begin
+    state_d = state_q;
+    done_s  = 1'b0;
+    unique case (state_q)
+      IDLE: begin
+        if (start_s) begin
+          if (reg2hw.d1_len.q != 16'd0) state_d = READ;
+          else if (reg2hw.next_desc.q != 32'd0) state_d = DESC_READ;
+          else done_s = 1'b1;
+        end
+      end
+      READ: begin
+        if (last_req_s) state_d = READ_WAIT;
+      end
+      READ_WAIT: begin
+        if (last_rsp_s) state_d = WRITE;
+      end
+      WRITE: begin
+        if (last_req_s) state_d = WRITE_WAIT;
+      end
+      WRITE_WAIT: begin
+        if (last_rsp_s) begin
+          if (!(last_burst_s && last_row_s)) state_d = READ;
+          else if (next_desc_q != 32'd0) state_d = DESC_READ;
+          else begin
+            state_d = IDLE;
+            done_s  = 1'b1;
+          end
+        end
+      end
+      DESC_READ: begin
+        if (last_req_s) state_d = DESC_WAIT;
+      end
+      DESC_WAIT: begin
+        if (last_rsp_s) begin
+          //Empty descriptor: follow the chain without moving data
+          if (d1_len_q != 16'd0) state_d = READ;
+          else if (dma_master_resp_i.rdata != 32'd0) state_d = DESC_READ;
+          else begin
+            state_d = IDLE;
+            done_s  = 1'b1;
+          end
+        end
+      end
+      default: state_d = IDLE;
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      state_q      <= IDLE;
+      src_row_q    <= '0;
+      dst_row_q    <= '0;
+      src_ptr_q    <= '0;
+      dst_ptr_q    <= '0;
+      d1_len_q     <= '0;
+      d2_len_q     <= '0;
+      src_stride_q <= '0;
+      dst_stride_q <= '0;
+      next_desc_q  <= '0;
+      d1_cnt_q     <= '0;
+      d2_cnt_q     <= '0;
+      data_q       <= '0;
+      req_cnt_q    <= '0;
+      rsp_cnt_q    <= '0;
+    end else begin
+      state_q <= state_d;
+
+      //Both counters wrap to 0 at the end of their phase
+      if (dma_master_req_o.req && dma_master_resp_i.gnt)
+        req_cnt_q <= last_req_s ? '0 : req_cnt_q + 1'b1;
+      if (dma_master_resp_i.rvalid) rsp_cnt_q <= last_rsp_s ? '0 : rsp_cnt_q + 1'b1;
+
+      //Read data of the burst, possibly returned while later reads are issued
+      if (read_phase_s && dma_master_resp_i.rvalid) data_q[rsp_cnt_q] <= dma_master_resp_i.rdata;
+
+      unique case (state_q)
+        IDLE: begin
+          if (start_s) begin
+            src_row_q    <= reg2hw.src_addr.q;
+            dst_row_q    <= reg2hw.dst_addr.q;
+            src_ptr_q    <= reg2hw.src_addr.q;
+            dst_ptr_q    <= reg2hw.dst_addr.q;
+            d1_len_q     <= reg2hw.d1_len.q;
+            d2_len_q     <= reg2hw.d2_len.q;
+            src_stride_q <= reg2hw.src_stride.q;
+            dst_stride_q <= reg2hw.dst_stride.q;
+            next_desc_q  <= reg2hw.next_desc.q;
+            d1_cnt_q     <= '0;
+            d2_cnt_q     <= '0;
+          end
+        end
+        WRITE_WAIT: begin
+          if (last_rsp_s) begin
+            if (!last_burst_s) begin
+              d1_cnt_q  <= d1_cnt_q + 16'(burst_len_s);
+              src_ptr_q <= src_ptr_q + {burst_len_s, 2'b00};
+              dst_ptr_q <= dst_ptr_q + {burst_len_s, 2'b00};
+            end else if (!last_row_s) begin
+              d1_cnt_q  <= '0;
+              d2_cnt_q  <= d2_cnt_q + 16'd1;
+              src_row_q <= src_row_q + src_stride_q;
+              dst_row_q <= dst_row_q + dst_stride_q;
+              src_ptr_q <= src_row_q + src_stride_q;
+              dst_ptr_q <= dst_row_q + dst_stride_q;
+            end
+          end
+        end
+        DESC_READ, DESC_WAIT: begin
+          if (dma_master_resp_i.rvalid) begin
+            unique case (rsp_cnt_q)
+              3'd0: begin
+                src_row_q <= dma_master_resp_i.rdata;
+                src_ptr_q <= dma_master_resp_i.rdata;
+              end
+              3'd1: begin
+                dst_row_q <= dma_master_resp_i.rdata;
+                dst_ptr_q <= dma_master_resp_i.rdata;
+              end
+              3'd2: d1_len_q <= dma_master_resp_i.rdata[15:0];
+              3'd3: d2_len_q <= dma_master_resp_i.rdata[15:0];
+              3'd4: src_stride_q <= dma_master_resp_i.rdata;
+              3'd5: dst_stride_q <= dma_master_resp_i.rdata;
+              default: next_desc_q <= dma_master_resp_i.rdata;
+            endcase
+            d1_cnt_q <= '0;
+            d2_cnt_q <= '0;
+          end
+        end
+        default: ;
+      endcase
+    end
+  end
+
+endmodule : sap_dma
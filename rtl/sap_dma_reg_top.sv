@@ -0,0 +1,573 @@
+// Copyright lowRISC contributors.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Register Top module auto-generated by `reggen`
+
+
+`include "common_cells/assertions.svh"
+
+module sap_dma_reg_top #(
+    parameter type reg_req_t = logic,
+    parameter type reg_rsp_t = logic,
+    parameter int AW = 6
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    input reg_req_t reg_req_i,
+    output reg_rsp_t reg_rsp_o,
+    // To HW
+    output sap_dma_reg_pkg::sap_dma_reg2hw_t reg2hw,  // Write
+    input sap_dma_reg_pkg::sap_dma_hw2reg_t hw2reg,  // Read
+
+
+    // Config
+    input devmode_i  // If 1, explicit error return for unmapped register access
+);
+
+  import sap_dma_reg_pkg::*;
+
+  localparam int DW = 32;
+  localparam int DBW = DW / 8;  // Byte Width
+
+  // register signals
+  logic           reg_we;
+  logic           reg_re;
+  logic [ AW-1:0] reg_addr;
+  logic [ DW-1:0] reg_wdata;
+  logic [DBW-1:0] reg_be;
+  logic [ DW-1:0] reg_rdata;
+  logic           reg_error;
+
+  logic addrmiss, wr_err;
+
+  logic [DW-1:0] reg_rdata_next;
+
+  // Below register interface can be changed
+  reg_req_t reg_intf_req;
+  reg_rsp_t reg_intf_rsp;
+
+
+  assign reg_intf_req = reg_req_i;
+  assign reg_rsp_o = reg_intf_rsp;
+
+
+  assign reg_we = reg_intf_req.valid & reg_intf_req.write;
+  assign reg_re = reg_intf_req.valid & ~reg_intf_req.write;
+  assign reg_addr = reg_intf_req.addr;
+  assign reg_wdata = reg_intf_req.wdata;
+  assign reg_be = reg_intf_req.wstrb;
+  assign reg_intf_rsp.rdata = reg_rdata;
+  assign reg_intf_rsp.error = reg_error;
+  assign reg_intf_rsp.ready = 1'b1;
+
+  assign reg_rdata = reg_rdata_next;
+  assign reg_error = (devmode_i & addrmiss) | wr_err;
+
+
+  // Define SW related signals
+  // Format: <reg>_<field>_{wd|we|qs}
+  //        or <reg>_{wd|we|qs} if field == 1 or 0
+  logic [31:0] src_addr_qs;
+  logic [31:0] src_addr_wd;
+  logic src_addr_we;
+  logic [31:0] dst_addr_qs;
+  logic [31:0] dst_addr_wd;
+  logic dst_addr_we;
+  logic [15:0] d1_len_qs;
+  logic [15:0] d1_len_wd;
+  logic d1_len_we;
+  logic [15:0] d2_len_qs;
+  logic [15:0] d2_len_wd;
+  logic d2_len_we;
+  logic [31:0] src_stride_qs;
+  logic [31:0] src_stride_wd;
+  logic src_stride_we;
+  logic [31:0] dst_stride_qs;
+  logic [31:0] dst_stride_wd;
+  logic dst_stride_we;
+  logic [31:0] next_desc_qs;
+  logic [31:0] next_desc_wd;
+  logic next_desc_we;
+  logic ctrl_start_qs;
+  logic ctrl_start_wd;
+  logic ctrl_start_we;
+  logic ctrl_irq_en_qs;
+  logic ctrl_irq_en_wd;
+  logic ctrl_irq_en_we;
+  logic status_busy_qs;
+  logic status_done_qs;
+  logic status_done_wd;
+  logic status_done_we;
+
+  // Register instances
+  // R[src_addr]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_src_addr (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(src_addr_we),
+      .wd(src_addr_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.src_addr.q),
+
+      // to register interface (read)
+      .qs(src_addr_qs)
+  );
+
+
+  // R[dst_addr]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_dst_addr (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(dst_addr_we),
+      .wd(dst_addr_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.dst_addr.q),
+
+      // to register interface (read)
+      .qs(dst_addr_qs)
+  );
+
+
+  // R[d1_len]: V(False)
+
+  prim_subreg #(
+      .DW      (16),
+      .SWACCESS("RW"),
+      .RESVAL  (16'h0)
+  ) u_d1_len (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(d1_len_we),
+      .wd(d1_len_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.d1_len.q),
+
+      // to register interface (read)
+      .qs(d1_len_qs)
+  );
+
+
+  // R[d2_len]: V(False)
+
+  prim_subreg #(
+      .DW      (16),
+      .SWACCESS("RW"),
+      .RESVAL  (16'h0)
+  ) u_d2_len (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(d2_len_we),
+      .wd(d2_len_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.d2_len.q),
+
+      // to register interface (read)
+      .qs(d2_len_qs)
+  );
+
+
+  // R[src_stride]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_src_stride (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(src_stride_we),
+      .wd(src_stride_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.src_stride.q),
+
+      // to register interface (read)
+      .qs(src_stride_qs)
+  );
+
+
+  // R[dst_stride]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_dst_stride (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(dst_stride_we),
+      .wd(dst_stride_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.dst_stride.q),
+
+      // to register interface (read)
+      .qs(dst_stride_qs)
+  );
+
+
+  // R[next_desc]: V(False)
+
+  prim_subreg #(
+      .DW      (32),
+      .SWACCESS("RW"),
+      .RESVAL  (32'h0)
+  ) u_next_desc (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(next_desc_we),
+      .wd(next_desc_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.next_desc.q),
+
+      // to register interface (read)
+      .qs(next_desc_qs)
+  );
+
+
+  // R[ctrl]: V(False)
+
+  //   F[start]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_ctrl_start (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(ctrl_start_we),
+      .wd(ctrl_start_wd),
+
+      // from internal hardware
+      .de(hw2reg.ctrl.start.de),
+      .d (hw2reg.ctrl.start.d),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.ctrl.start.q),
+
+      // to register interface (read)
+      .qs(ctrl_start_qs)
+  );
+
+
+  //   F[irq_en]: 1:1
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_ctrl_irq_en (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(ctrl_irq_en_we),
+      .wd(ctrl_irq_en_wd),
+
+      // from internal hardware
+      .de(1'b0),
+      .d ('0),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.ctrl.irq_en.q),
+
+      // to register interface (read)
+      .qs(ctrl_irq_en_qs)
+  );
+
+
+  // R[status]: V(False)
+
+  //   F[busy]: 0:0
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RO"),
+      .RESVAL  (1'h0)
+  ) u_status_busy (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      .we(1'b0),
+      .wd('0),
+
+      // from internal hardware
+      .de(hw2reg.status.busy.de),
+      .d (hw2reg.status.busy.d),
+
+      // to internal hardware
+      .qe(),
+      .q (),
+
+      // to register interface (read)
+      .qs(status_busy_qs)
+  );
+
+
+  //   F[done]: 1:1
+  prim_subreg #(
+      .DW      (1),
+      .SWACCESS("RW"),
+      .RESVAL  (1'h0)
+  ) u_status_done (
+      .clk_i (clk_i),
+      .rst_ni(rst_ni),
+
+      // from register interface
+      .we(status_done_we),
+      .wd(status_done_wd),
+
+      // from internal hardware
+      .de(hw2reg.status.done.de),
+      .d (hw2reg.status.done.d),
+
+      // to internal hardware
+      .qe(),
+      .q (reg2hw.status.done.q),
+
+      // to register interface (read)
+      .qs(status_done_qs)
+  );
+
+
+
+
+  logic [8:0] addr_hit;
+  always_comb begin
+    addr_hit = '0;
+    addr_hit[0] = (reg_addr == SAP_DMA_SRC_ADDR_OFFSET);
+    addr_hit[1] = (reg_addr == SAP_DMA_DST_ADDR_OFFSET);
+    addr_hit[2] = (reg_addr == SAP_DMA_D1_LEN_OFFSET);
+    addr_hit[3] = (reg_addr == SAP_DMA_D2_LEN_OFFSET);
+    addr_hit[4] = (reg_addr == SAP_DMA_SRC_STRIDE_OFFSET);
+    addr_hit[5] = (reg_addr == SAP_DMA_DST_STRIDE_OFFSET);
+    addr_hit[6] = (reg_addr == SAP_DMA_NEXT_DESC_OFFSET);
+    addr_hit[7] = (reg_addr == SAP_DMA_CTRL_OFFSET);
+    addr_hit[8] = (reg_addr == SAP_DMA_STATUS_OFFSET);
+  end
+
+  assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0;
+
+  // Check sub-word write is permitted
+  always_comb begin
+    wr_err = (reg_we &
+              ((addr_hit[0] & (|(SAP_DMA_PERMIT[0] & ~reg_be))) |
+               (addr_hit[1] & (|(SAP_DMA_PERMIT[1] & ~reg_be))) |
+               (addr_hit[2] & (|(SAP_DMA_PERMIT[2] & ~reg_be))) |
+               (addr_hit[3] & (|(SAP_DMA_PERMIT[3] & ~reg_be))) |
+               (addr_hit[4] & (|(SAP_DMA_PERMIT[4] & ~reg_be))) |
+               (addr_hit[5] & (|(SAP_DMA_PERMIT[5] & ~reg_be))) |
+               (addr_hit[6] & (|(SAP_DMA_PERMIT[6] & ~reg_be))) |
+               (addr_hit[7] & (|(SAP_DMA_PERMIT[7] & ~reg_be))) |
+               (addr_hit[8] & (|(SAP_DMA_PERMIT[8] & ~reg_be)))));
+  end
+
+  assign src_addr_we = addr_hit[0] & reg_we & !reg_error;
+  assign src_addr_wd = reg_wdata[31:0];
+
+  assign dst_addr_we = addr_hit[1] & reg_we & !reg_error;
+  assign dst_addr_wd = reg_wdata[31:0];
+
+  assign d1_len_we = addr_hit[2] & reg_we & !reg_error;
+  assign d1_len_wd = reg_wdata[15:0];
+
+  assign d2_len_we = addr_hit[3] & reg_we & !reg_error;
+  assign d2_len_wd = reg_wdata[15:0];
+
+  assign src_stride_we = addr_hit[4] & reg_we & !reg_error;
+  assign src_stride_wd = reg_wdata[31:0];
+
+  assign dst_stride_we = addr_hit[5] & reg_we & !reg_error;
+  assign dst_stride_wd = reg_wdata[31:0];
+
+  assign next_desc_we = addr_hit[6] & reg_we & !reg_error;
+  assign next_desc_wd = reg_wdata[31:0];
+
+  assign ctrl_start_we = addr_hit[7] & reg_we & !reg_error;
+  assign ctrl_start_wd = reg_wdata[0];
+
+  assign ctrl_irq_en_we = addr_hit[7] & reg_we & !reg_error;
+  assign ctrl_irq_en_wd = reg_wdata[1];
+
+  assign status_done_we = addr_hit[8] & reg_we & !reg_error;
+  assign status_done_wd = reg_wdata[1];
+
+  // Read data return
+  always_comb begin
+    reg_rdata_next = '0;
+    unique case (1'b1)
+      addr_hit[0]: begin
+        reg_rdata_next[31:0] = src_addr_qs;
+      end
+
+      addr_hit[1]: begin
+        reg_rdata_next[31:0] = dst_addr_qs;
+      end
+
+      addr_hit[2]: begin
+        reg_rdata_next[15:0] = d1_len_qs;
+      end
+
+      addr_hit[3]: begin
+        reg_rdata_next[15:0] = d2_len_qs;
+      end
+
+      addr_hit[4]: begin
+        reg_rdata_next[31:0] = src_stride_qs;
+      end
+
+      addr_hit[5]: begin
+        reg_rdata_next[31:0] = dst_stride_qs;
+      end
+
+      addr_hit[6]: begin
+        reg_rdata_next[31:0] = next_desc_qs;
+      end
+
+      addr_hit[7]: begin
+        reg_rdata_next[0] = ctrl_start_qs;
+        reg_rdata_next[1] = ctrl_irq_en_qs;
+      end
+
+      addr_hit[8]: begin
+        reg_rdata_next[0] = status_busy_qs;
+        reg_rdata_next[1] = status_done_qs;
+      end
+
+      default: begin
+        reg_rdata_next = '1;
+      end
+    endcase
+  end
+
+  // Unused signal tieoff
+
+  // wdata / byte enable are not always fully used
+  // add a blanket unused statement to handle lint waivers
+  logic unused_wdata;
+  logic unused_be;
+  assign unused_wdata = ^reg_wdata;
+  assign unused_be = ^reg_be;
+
+  // Assertions for Register Interface
+  `ASSERT(en2addrHit, (reg_we || reg_re) |-> $onehot0(addr_hit))
+
+endmodule
+
+module sap_dma_reg_top_intf #(
+    parameter  int AW = 6,
+    localparam int DW = 32
+) (
+    input logic clk_i,
+    input logic rst_ni,
+    REG_BUS.in regbus_slave,
+    // To HW
+    output sap_dma_reg_pkg::sap_dma_reg2hw_t reg2hw,  // Write
+    input sap_dma_reg_pkg::sap_dma_hw2reg_t hw2reg,  // Read
+    // Config
+    input devmode_i  // If 1, explicit error return for unmapped register access
+);
+  localparam int unsigned STRB_WIDTH = DW / 8;
+
+  `include "register_interface/typedef.svh"
+  `include "register_interface/assign.svh"
+
+  // Define structs for reg_bus
+  typedef logic [AW-1:0] addr_t;
+  typedef logic [DW-1:0] data_t;
+  typedef logic [STRB_WIDTH-1:0] strb_t;
+  `REG_BUS_TYPEDEF_ALL(reg_bus, addr_t, data_t, strb_t)
+
+  reg_bus_req_t s_reg_req;
+  reg_bus_rsp_t s_reg_rsp;
+
+  // Assign SV interface to structs
+  `REG_BUS_ASSIGN_TO_REQ(s_reg_req, regbus_slave)
+  `REG_BUS_ASSIGN_FROM_RSP(regbus_slave, s_reg_rsp)
+
+
+
+  sap_dma_reg_top #(
+      .reg_req_t(reg_bus_req_t),
+      .reg_rsp_t(reg_bus_rsp_t),
+      .AW(AW)
+  ) i_regs (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i(s_reg_req),
+      .reg_rsp_o(s_reg_rsp),
+      .reg2hw,  // Write
+      .hw2reg,  // Read
+      .devmode_i
+  );
+
+endmodule
+
+
@@ -0,0 +1,220 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Instruction line buffer with next-line prefetch, one per safe_cpu_wrapper
+// instruction port (after the TMR voter / DMR comparator).
+//  - Two lines of LINE_WORDS words. A hit is granted in the same cycle and
+//    answered in the next one, so sequential fetch runs at one word per cycle.
+//  - A miss refills the line starting at the missed word; the words are
+//    served as they arrive. A hit on a line prefetches the next one into the
+//    other entry.
+//  - Only [START_ADDR, END_ADDR) is buffered, other fetches go straight
+//    through and may be pipelined as long as nothing is buffered in between.
+//  - flush_i drops everything (the core sleeps between jobs); inv_i drops
+//    the line of a data write of the same core. Writes of another hart, the
+//    DMA or the external master are not snooped: code written by them is
+//    only fetched correctly after the core slept (flush) once.
+//  - A stopped refill (miss, flush, invalidation) keeps a request already on
+//    the bus until it is granted (OBI), only the next words are cancelled.
+
+module sap_ibuf #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned LINE_WORDS = sap_pkg::IBUF_LINE_WORDS,
+    parameter logic [31:0] START_ADDR = sap_pkg::MEMORY_START_ADDRESS,
+    parameter logic [31:0] END_ADDR   = sap_pkg::MEMORY_END_ADDRESS
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input logic        flush_i,
+    input logic        inv_i,
+    input logic [31:0] inv_addr_i,
+
+    // Core side
+    input  obi_req_t  instr_req_i,
+    output obi_resp_t instr_resp_o,
+
+    // Bus side
+    output obi_req_t  instr_req_o,
+    input  obi_resp_t instr_resp_i
+);
+
+  localparam int unsigned WordBits = $clog2(LINE_WORDS);
+  localparam int unsigned LineBits = WordBits + 2;
+  localparam int unsigned TagWidth = 32 - LineBits;
+
+  typedef logic [TagWidth-1:0] tag_t;
+  typedef logic [WordBits-1:0] word_t;
+
+  //Lines
+  logic [1:0] tag_valid_q;
+  tag_t [1:0] tag_q;
+  logic [1:0][LINE_WORDS-1:0] wvalid_q;
+  logic [1:0][LINE_WORDS-1:0][31:0] data_q;
+  logic mru_q;
+
+  //Refill
+  logic fill_active_q, fill_stop_q, fill_e_q, fill_req_q;
+  tag_t fill_tag_q;
+  word_t fill_first_q;
+  logic [WordBits:0] req_cnt_q, rsp_cnt_q;
+  logic fill_issue, fill_done;
+  word_t fill_req_word, fill_rsp_word;
+
+  //Core side
+  logic [1:0] byp_cnt_q;
+  logic byp_pending, hit_valid_q;
+  logic [31:0] hit_data_q;
+
+  tag_t c_tag, next_tag;
+  word_t c_word;
+  logic cacheable, next_cacheable;
+  logic [1:0] match, hit, next_match;
+  logic hit_e, victim;
+  logic gnt, bypass;
+  logic start_demand, start_prefetch;
+
+  assign c_tag    = instr_req_i.addr[31:LineBits];
+  assign c_word   = instr_req_i.addr[LineBits-1:2];
+  assign next_tag = c_tag + 1'b1;
+
+  assign cacheable      = (instr_req_i.addr >= START_ADDR) && (instr_req_i.addr < END_ADDR);
+  assign next_cacheable = ({next_tag, {LineBits{1'b0}}} >= START_ADDR) &&
+                          ({next_tag, {LineBits{1'b0}}} < END_ADDR) && (next_tag != '0);
+
+  for (genvar e = 0; e < 2; e++) begin : gen_match
+    assign match[e]      = tag_valid_q[e] && (tag_q[e] == c_tag);
+    assign hit[e]        = match[e] && wvalid_q[e][c_word];
+    assign next_match[e] = tag_valid_q[e] && (tag_q[e] == next_tag);
+  end
+
+  assign hit_e  = hit[1];
+  assign victim = !tag_valid_q[0] ? 1'b0 : !tag_valid_q[1] ? 1'b1 : ~mru_q;
+
+  //Non buffered fetch, only with no refill on the bus side
+  assign byp_pending = (byp_cnt_q != '0);
+  assign bypass = instr_req_i.req && !cacheable && !fill_active_q && (byp_cnt_q != '1);
+
+  always_comb begin
+    gnt = 1'b0;
+    if (instr_req_i.req) begin
+      gnt = cacheable ? |hit && !byp_pending : bypass && instr_resp_i.gnt;
+    end
+  end
+
+  assign start_demand = instr_req_i.req && cacheable && !(|match) && !fill_active_q &&
+                        !byp_pending && !flush_i && !inv_i;
+  assign start_prefetch = gnt && cacheable && next_cacheable && !(|next_match) &&
+                          !fill_active_q && !flush_i && !inv_i;
+
+  //Bus side
+  //fill_req_q: request presented and not granted, it stays up until the grant
+  assign fill_issue    = fill_active_q && (fill_req_q || (!fill_stop_q && req_cnt_q != LINE_WORDS));
+  assign fill_done     = fill_active_q && !fill_issue && (rsp_cnt_q == req_cnt_q);
+  assign fill_req_word = fill_first_q + req_cnt_q[WordBits-1:0];
+  assign fill_rsp_word = fill_first_q + rsp_cnt_q[WordBits-1:0];
+
+  always_comb begin
+    instr_req_o = '0;
+    if (bypass) begin
+      instr_req_o = instr_req_i;
+    end else if (fill_issue) begin
+      instr_req_o.req  = 1'b1;
+      instr_req_o.be   = '1;
+      instr_req_o.addr = {fill_tag_q, fill_req_word, 2'b00};
+    end
+  end
+
+  assign instr_resp_o = '{
+          gnt: gnt,
+          rvalid: hit_valid_q | (byp_pending & instr_resp_i.rvalid),
+          rdata: hit_valid_q ? hit_data_q : instr_resp_i.rdata
+      };
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      tag_valid_q   <= '0;
+      tag_q         <= '0;
+      wvalid_q      <= '0;
+      data_q        <= '0;
+      mru_q         <= 1'b0;
+      fill_active_q <= 1'b0;
+      fill_stop_q   <= 1'b0;
+      fill_e_q      <= 1'b0;
+      fill_req_q    <= 1'b0;
+      fill_tag_q    <= '0;
+      fill_first_q  <= '0;
+      req_cnt_q     <= '0;
+      rsp_cnt_q     <= '0;
+      byp_cnt_q     <= '0;
+      hit_valid_q   <= 1'b0;
+      hit_data_q    <= '0;
+    end else begin
+      //Core response
+      hit_valid_q <= gnt && cacheable;
+      if (gnt && cacheable) begin
+        hit_data_q <= data_q[hit_e][c_word];
+        mru_q      <= hit_e;
+      end
+      unique case ({bypass && instr_resp_i.gnt, byp_pending && instr_resp_i.rvalid})
+        2'b10:   byp_cnt_q <= byp_cnt_q + 1'b1;
+        2'b01:   byp_cnt_q <= byp_cnt_q - 1'b1;
+        default: ;
+      endcase
+
+      //Refill progress
+      if (fill_issue && instr_resp_i.gnt) req_cnt_q <= req_cnt_q + 1'b1;
+      fill_req_q <= fill_issue && !instr_resp_i.gnt;
+      if (fill_active_q && instr_resp_i.rvalid) begin
+        data_q[fill_e_q][fill_rsp_word]   <= instr_resp_i.rdata;
+        wvalid_q[fill_e_q][fill_rsp_word] <= 1'b1;
+        rsp_cnt_q                         <= rsp_cnt_q + 1'b1;
+      end
+      if (fill_done) fill_active_q <= 1'b0;
+
+      //A miss cancels the words of a prefetch not yet requested
+      if (instr_req_i.req && cacheable && !(|match) && fill_active_q) begin
+        fill_stop_q <= 1'b1;
+        tag_valid_q[fill_e_q] <= 1'b0;
+      end
+
+      //Refill start
+      if (start_demand || start_prefetch) begin
+        fill_active_q <= 1'b1;
+        fill_stop_q   <= 1'b0;
+        fill_e_q      <= start_demand ? victim : ~hit_e;
+        fill_tag_q    <= start_demand ? c_tag : next_tag;
+        fill_first_q  <= start_demand ? c_word : '0;
+        req_cnt_q     <= '0;
+        rsp_cnt_q     <= '0;
+        if (start_demand) begin
+          tag_valid_q[victim] <= 1'b1;
+          tag_q[victim]       <= c_tag;
+          wvalid_q[victim]    <= '0;
+          mru_q               <= victim;
+        end else begin
+          tag_valid_q[~hit_e] <= 1'b1;
+          tag_q[~hit_e]       <= next_tag;
+          wvalid_q[~hit_e]    <= '0;
+        end
+      end
+
+      //Invalidation
+      if (flush_i) begin
+        tag_valid_q <= '0;
+        if (fill_active_q) fill_stop_q <= 1'b1;
+      end else if (inv_i) begin
+        for (int unsigned e = 0; e < 2; e++) begin
+          if (tag_q[e] == inv_addr_i[31:LineBits]) begin
+            tag_valid_q[e] <= 1'b0;
+            if (fill_active_q && fill_e_q == e[0]) fill_stop_q <= 1'b1;
+          end
+        end
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,187 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// SECDED protected RAM bank (single port), used by memory_sys when MEM_ECC.
+//  - Words are stored as 32 data + 7 check bits. Reads are corrected in the
+//    rvalid cycle, so the latency is the same as the plain bank.
+//  - Full word writes are encoded and written directly; partial writes do a
+//    read-modify-write and are granted one cycle later. If the word read has
+//    a double error the merged word is written with two check bits flipped,
+//    so it stays uncorrectable (and is reported again) instead of getting a
+//    valid codeword.
+//  - A corrected read (bus or scrub) is written back in the next cycle.
+//  - Scrubber: with scrub_en_i the bank reads one word per idle cycle.
+//  - corrected_o / uncorrected_o pulse once per single / double error.
+
+module sap_mem_ecc #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned NumWords = 32'd1024,
+    // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
+    parameter int unsigned AddrWidth = (NumWords > 32'd1) ? $clog2(NumWords) : 32'd1
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input  obi_req_t  req_i,
+    output obi_resp_t resp_o,
+
+    // Scrubber and error report
+    input  logic scrub_en_i,
+    output logic corrected_o,
+    output logic uncorrected_o,
+
+    // power manager signals that goes to the ASIC macros
+    input  logic pwrgate_ni,
+    output logic pwrgate_ack_no,
+    input  logic set_retentive_ni
+);
+
+  localparam int unsigned EccWidth = ecc_pkg::get_cw_width(32) + 1;
+
+  typedef enum logic [1:0] {
+    RD_NONE,
+    RD_BUS,
+    RD_SCRUB,
+    RD_RMW
+  } rd_kind_e;
+
+  rd_kind_e rd_kind_q, rd_kind_d;
+  logic [AddrWidth-1:0] rd_addr_q, scrub_addr_q;
+  logic fix_q, fix_d;
+  logic [AddrWidth-1:0] fix_addr_q;
+  logic [31:0] fix_data_q;
+  logic valid_q;
+
+  logic mem_req, mem_we;
+  logic [AddrWidth-1:0] mem_addr, bus_addr;
+  logic [EccWidth-1:0] mem_wdata, mem_rdata, enc_cw;
+  logic [31:0] enc_data, dec_data, merged_data;
+  logic single_err, parity_err, double_err;
+  logic rd_valid, rmw_abort, rmw_poison, gnt;
+
+  assign bus_addr = req_i.addr[AddrWidth+1:2];
+
+  //Decode of the word read in the previous cycle
+  ecc_decode #(
+      .DataWidth(32)
+  ) ecc_decode_i (
+      .data_i        (mem_rdata),
+      .data_o        (dec_data),
+      .syndrome_o    (),
+      .single_error_o(single_err),
+      .parity_error_o(parity_err),
+      .double_error_o(double_err)
+  );
+
+  always_comb begin
+    for (int unsigned b = 0; b < 4; b++) begin
+      merged_data[b*8+:8] = req_i.be[b] ? req_i.wdata[b*8+:8] : dec_data[b*8+:8];
+    end
+  end
+
+  //One encoder: write back, read-modify-write or bus write
+  assign enc_data = fix_q ? fix_data_q : (rd_kind_q == RD_RMW) ? merged_data : req_i.wdata;
+
+  ecc_encode #(
+      .DataWidth(32)
+  ) ecc_encode_i (
+      .data_i(enc_data),
+      .data_o(enc_cw)
+  );
+
+  //Any two flipped bits of a SECDED codeword decode as a double error
+  assign mem_wdata = rmw_poison ? (enc_cw ^ {2'b11, {(EccWidth - 2) {1'b0}}}) : enc_cw;
+
+  //Port arbitration: write back > RMW write > bus > scrubber
+  always_comb begin
+    mem_req   = 1'b0;
+    mem_we    = 1'b0;
+    mem_addr  = bus_addr;
+    gnt       = 1'b0;
+    rd_kind_d = RD_NONE;
+
+    if (fix_q) begin
+      mem_req  = 1'b1;
+      mem_we   = 1'b1;
+      mem_addr = fix_addr_q;
+    end else if (rd_kind_q == RD_RMW) begin
+      mem_req = 1'b1;
+      mem_we  = 1'b1;
+      gnt     = 1'b1;
+    end else if (req_i.req) begin
+      mem_req = 1'b1;
+      if (!req_i.we) begin
+        gnt       = 1'b1;
+        rd_kind_d = RD_BUS;
+      end else if (req_i.be == 4'b1111) begin
+        mem_we = 1'b1;
+        gnt    = 1'b1;
+      end else begin
+        rd_kind_d = RD_RMW;
+      end
+    end else if (scrub_en_i) begin
+      mem_req   = 1'b1;
+      mem_addr  = scrub_addr_q;
+      rd_kind_d = RD_SCRUB;
+    end
+  end
+
+  //An RMW read overtaken by a write back is restarted and not reported
+  assign rd_valid  = (rd_kind_q != RD_NONE);
+  assign rmw_abort = fix_q && (rd_kind_q == RD_RMW);
+  assign rmw_poison = (rd_kind_q == RD_RMW) && !fix_q && double_err;
+
+  assign corrected_o   = rd_valid && !rmw_abort && (single_err || parity_err);
+  assign uncorrected_o = rd_valid && !rmw_abort && double_err;
+
+  //Write back, dropped if the same word is fully written in this cycle
+  assign fix_d = (rd_kind_q == RD_BUS || rd_kind_q == RD_SCRUB) && (single_err || parity_err) &&
+                 !(gnt && mem_we && mem_addr == rd_addr_q);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      rd_kind_q    <= RD_NONE;
+      rd_addr_q    <= '0;
+      scrub_addr_q <= '0;
+      fix_q        <= 1'b0;
+      fix_addr_q   <= '0;
+      fix_data_q   <= '0;
+      valid_q      <= 1'b0;
+    end else begin
+      rd_kind_q <= rd_kind_d;
+      rd_addr_q <= mem_addr;
+      fix_q     <= fix_d;
+      valid_q   <= gnt;
+      if (fix_d) begin
+        fix_addr_q <= rd_addr_q;
+        fix_data_q <= dec_data;
+      end
+      if (rd_kind_d == RD_SCRUB) begin
+        scrub_addr_q <= (scrub_addr_q == AddrWidth'(NumWords - 1)) ? '0 : scrub_addr_q + 1'b1;
+      end
+    end
+  end
+
+  assign resp_o = '{gnt: gnt, rvalid: valid_q, rdata: dec_data};
+
+  sram_wrapper #(
+      .NumWords (NumWords),
+      .DataWidth(EccWidth)
+  ) mem_i (
+      .clk_i(clk_i),
+      .rst_ni(rst_ni),
+      .req_i(mem_req),
+      .we_i(mem_we),
+      .addr_i(mem_addr),
+      .wdata_i(mem_wdata),
+      .be_i('1),
+      .pwrgate_ni(pwrgate_ni),
+      .pwrgate_ack_no(pwrgate_ack_no),
+      .set_retentive_ni(set_retentive_ni),
+      .rdata_o(mem_rdata)
+  );
+
+endmodule
@@ -0,0 +1,75 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Private scratchpad of one hart. Instruction and data ports share a single
+// sram_wrapper; the data port wins on a conflict. A request is granted in the
+// same cycle and answered in the next one, as in memory_sys, so back to back
+// accesses run at one per cycle with no crossbar in the path.
+// The contents are per hart and are not part of any redundancy sync: the
+// TMR/DCLS entry, the checkpoint rollback and the master failover only copy
+// the register context. crt0 only loads the TCM of the hart that runs it (the
+// booting hart), the slaves started by halt_boot keep an empty TCM. The TCM
+// is therefore for single mode only: no __tcm code or data may be used in
+// TMR/DCLS or be live across a mode switch, a rollback or a failover.
+
+module sap_tcm #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned SIZE = sap_pkg::TCM_SIZE
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input  obi_req_t  instr_req_i,
+    output obi_resp_t instr_resp_o,
+
+    input  obi_req_t  data_req_i,
+    output obi_resp_t data_resp_o
+);
+
+  localparam int NumWords = SIZE / 4;
+  localparam int AddrWidth = $clog2(SIZE);
+
+  obi_req_t mem_req;
+  logic [31:0] mem_rdata;
+  logic instr_gnt, data_gnt;
+  logic instr_valid_q, data_valid_q;
+
+  //Data has priority over instruction fetch
+  assign data_gnt  = data_req_i.req;
+  assign instr_gnt = instr_req_i.req & ~data_req_i.req;
+  assign mem_req   = data_req_i.req ? data_req_i : instr_req_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      instr_valid_q <= '0;
+      data_valid_q  <= '0;
+    end else begin
+      instr_valid_q <= instr_gnt;
+      data_valid_q  <= data_gnt;
+    end
+  end
+
+  assign instr_resp_o = '{gnt: instr_gnt, rvalid: instr_valid_q, rdata: mem_rdata};
+  assign data_resp_o  = '{gnt: data_gnt, rvalid: data_valid_q, rdata: mem_rdata};
+
+  sram_wrapper #(
+      .NumWords (NumWords),
+      .DataWidth(32'd32)
+  ) mem_i (
+      .clk_i(clk_i),
+      .rst_ni(rst_ni),
+      .req_i(mem_req.req),
+      .we_i(mem_req.we),
+      .addr_i(mem_req.addr[AddrWidth-1:2]),
+      .wdata_i(mem_req.wdata),
+      .be_i(mem_req.be),
+      .pwrgate_ni(1'b1),
+      .pwrgate_ack_no(),
+      .set_retentive_ni(1'b1),
+      .rdata_o(mem_rdata)
+  );
+
+endmodule
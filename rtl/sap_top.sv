@@ -9,8 +9,8 @@ module sap_top
 #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NHARTS  = 3,
-    parameter N_BANKS = 2
+    parameter NHARTS  = sap_pkg::NHARTS,
+    parameter N_BANKS = sap_pkg::NUM_BANKS
 ) (
     // Clock and Reset
     input logic clk_i,
@@ -56,19 +56,33 @@ module sap_top
   reg_req_t wrapper_csr_req;
   reg_rsp_t wrapper_csr_resp;
 
+  // DMA master port
+  obi_req_t dma_master_req;
+  obi_resp_t dma_master_resp;
+  logic dma_intr;
+  logic dma_start;
+
+  // System xbar QoS
+  xbar_qos_t xbar_qos;
+
+  // RAM ECC
+  logic mem_scrub_en;
+  logic [N_BANKS-1:0] ecc_corrected, ecc_uncorrected;
+
   // Internal slave ports
   obi_req_t peripheral_slave_req;
   obi_resp_t peripheral_slave_resp;
 
   // RAM memory ports
-  obi_req_t [N_BANKS-1:0] ram_req;
-  obi_resp_t [N_BANKS-1:0] ram_resp;
+  obi_req_t [N_BANKS*MEM_PORTS-1:0] ram_req;
+  obi_resp_t [N_BANKS*MEM_PORTS-1:0] ram_resp;
 
 
   //CPU_System
   safe_cpu_wrapper #(
       .obi_req_t            (obi_req_t  ),
-      .obi_resp_t           (obi_resp_t )
+      .obi_resp_t           (obi_resp_t ),
+      .NHARTS               (NHARTS     )
       ) safe_cpu_wrapper_i (
       .clk_i,
       .rst_ni,
@@ -89,6 +103,12 @@ module sap_top
       .debug_req_i,
       .sleep_o,
       // Interrupt Interface
+      .dma_intr_i(dma_intr),
+      .dma_start_i(dma_start),
+      .xbar_qos_o(xbar_qos),
+      .mem_scrub_en_o(mem_scrub_en),
+      .ecc_corrected_i(8'($countones(ecc_corrected))),
+      .ecc_uncorrected_i(8'($countones(ecc_uncorrected))),
       .interrupt_o
   );
 
@@ -100,12 +120,17 @@ module sap_top
       .clk_i,
       .rst_ni,
       .slave_req_i (peripheral_slave_req),
-      .slave_resp_o(peripheral_slave_resp)
+      .slave_resp_o(peripheral_slave_resp),
+      .dma_master_req_o (dma_master_req),
+      .dma_master_resp_i(dma_master_resp),
+      .dma_intr_o(dma_intr),
+      .dma_start_o(dma_start)
   );
 
   memory_sys #(
       .obi_req_t            (obi_req_t  ),
-      .obi_resp_t           (obi_resp_t )
+      .obi_resp_t           (obi_resp_t ),
+      .NUM_BANKS            (N_BANKS    )
     ) memory_sys_i (
       .clk_i,
       .rst_ni,
@@ -115,14 +140,19 @@ module sap_top
       // power manager signals that goes to the ASIC macros
       .pwrgate_ni,
       .pwrgate_ack_no,
-      .set_retentive_ni
+      .set_retentive_ni,
+      // ECC
+      .scrub_en_i(mem_scrub_en),
+      .ecc_corrected_o(ecc_corrected),
+      .ecc_uncorrected_o(ecc_uncorrected)
   );
 
   //Bus System
   bus_system #(
       .obi_req_t            (obi_req_t  ),
       .obi_resp_t           (obi_resp_t ),
-      .NHARTS(NHARTS)
+      .NHARTS(NHARTS),
+      .N_BANKS(N_BANKS)
   ) bus_system_i (
       .clk_i,
       .rst_ni,
@@ -136,6 +166,8 @@ module sap_top
 
       .ext_master_req_i,
       .ext_master_resp_o,
+      .dma_master_req_i (dma_master_req),
+      .dma_master_resp_o(dma_master_resp),
       .ext_slave_req_o,
       .ext_slave_resp_i,
 
@@ -149,6 +181,8 @@ module sap_top
       .ram_req_o (ram_req),
       .ram_resp_i(ram_resp),
 
+      .xbar_qos_i(xbar_qos),
+
       // Control Status Register Output
       .wrapper_csr_req_o(wrapper_csr_req),
       .wrapper_csr_rsp_i(wrapper_csr_resp)
@@ -0,0 +1,72 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// OBI 1-to-N demux with in-order multi-outstanding support.
+// Up to MAX_OUTSTANDING transactions can be in flight towards the same slave;
+// a request to a different slave waits until all of them have returned, so
+// responses always come back in issue order.
+
+module sap_xbar_demux #(
+    parameter type obi_req_t            = logic,
+    parameter type obi_resp_t           = logic,
+    parameter int unsigned XBAR_NSLAVE     = 2,
+    parameter int unsigned MAX_OUTSTANDING = 2,
+    // Dependent parameters: do not override!
+    localparam int unsigned IdxWidth = cf_math_pkg::idx_width(XBAR_NSLAVE)
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    // Selected slave
+    input logic [IdxWidth-1:0] port_sel_i,
+
+    // Master port
+    input  obi_req_t  master_req_i,
+    output obi_resp_t master_resp_o,
+
+    // Slave ports
+    output obi_req_t  [XBAR_NSLAVE-1:0] slave_req_o,
+    input  obi_resp_t [XBAR_NSLAVE-1:0] slave_resp_i
+);
+
+  localparam int unsigned CntWidth = $clog2(MAX_OUTSTANDING + 1);
+
+  logic [CntWidth-1:0] outstanding_q;
+  logic [IdxWidth-1:0] sel_q;
+  logic stall, accept, retire;
+
+  //Response of the oldest transaction
+  assign retire = (outstanding_q != '0) && slave_resp_i[sel_q].rvalid;
+
+  //Wait for the other slave to drain, or for a free slot
+  assign stall = ((outstanding_q != '0) && (port_sel_i != sel_q)) ||
+                 ((outstanding_q == CntWidth'(MAX_OUTSTANDING)) && !retire);
+
+  always_comb begin
+    for (int unsigned k = 0; k < XBAR_NSLAVE; k++) begin
+      slave_req_o[k]     = master_req_i;
+      slave_req_o[k].req = master_req_i.req && !stall && (port_sel_i == k);
+    end
+  end
+
+  assign accept = master_req_i.req && !stall && slave_resp_i[port_sel_i].gnt;
+
+  assign master_resp_o = '{
+          gnt: accept,
+          rvalid: retire,
+          rdata: slave_resp_i[sel_q].rdata
+      };
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      outstanding_q <= '0;
+      sel_q         <= '0;
+    end else begin
+      outstanding_q <= outstanding_q + CntWidth'(accept) - CntWidth'(retire);
+      if (accept) sel_q <= port_sel_i;
+    end
+  end
+
+endmodule
@@ -0,0 +1,117 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// QoS for the system xbar (xbar_varlat with ExtPrio).
+//  - Bandwidth cap: a master with bw_cap != 0 gets at most bw_cap grants per
+//    bw_window cycles, then its request is masked until the window restarts.
+//  - Priority: per slave only the requesting masters with the highest prio
+//    reach the arbiter.
+//  - Weighted round robin: per slave rr_o keeps the last granted master on top
+//    until it gets weight+1 consecutive grants.
+// Reset values (all 0) behave as plain round robin.
+
+module sap_xbar_qos #(
+    parameter int unsigned XBAR_NMASTER = 8,
+    parameter int unsigned XBAR_NSLAVE  = 5,
+    localparam int unsigned LogNMaster = XBAR_NMASTER > 1 ? $clog2(XBAR_NMASTER) : 32'd1,
+    localparam int unsigned LogNSlave  = XBAR_NSLAVE > 1 ? $clog2(XBAR_NSLAVE) : 32'd1
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    // Configuration
+    input logic [XBAR_NMASTER-1:0][1:0] prio_i,
+    input logic [XBAR_NMASTER-1:0][3:0] weight_i,
+    input logic [15:0] bw_window_i,
+    input logic [XBAR_NMASTER-1:0][7:0] bw_cap_i,
+
+    // Master requests
+    input  logic [XBAR_NMASTER-1:0] req_i,
+    input  logic [XBAR_NMASTER-1:0][LogNSlave-1:0] port_sel_i,
+    input  logic [XBAR_NMASTER-1:0] gnt_i,
+
+    // To the xbar
+    output logic [XBAR_NMASTER-1:0] req_o,
+    output logic [XBAR_NSLAVE-1:0][LogNMaster-1:0] rr_o
+);
+
+  //Bandwidth cap
+  logic [15:0] window_cnt_q;
+  logic [XBAR_NMASTER-1:0][7:0] bw_cnt_q;
+  logic [XBAR_NMASTER-1:0] capped;
+  logic window_end;
+
+  assign window_end = (bw_window_i == '0) || (window_cnt_q == bw_window_i - 16'd1);
+
+  for (genvar i = 0; i < XBAR_NMASTER; i++) begin : gen_cap
+    assign capped[i] = (bw_window_i != '0) && (bw_cap_i[i] != '0) && (bw_cnt_q[i] >= bw_cap_i[i]);
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      window_cnt_q <= '0;
+      bw_cnt_q     <= '0;
+    end else begin
+      if (window_end) begin
+        window_cnt_q <= '0;
+        bw_cnt_q     <= '0;
+      end else begin
+        window_cnt_q <= window_cnt_q + 16'd1;
+        for (int unsigned i = 0; i < XBAR_NMASTER; i++) begin
+          if (req_o[i] && gnt_i[i] && bw_cnt_q[i] != '1) bw_cnt_q[i] <= bw_cnt_q[i] + 8'd1;
+        end
+      end
+    end
+  end
+
+  //Priority
+  logic [XBAR_NMASTER-1:0] eligible;
+  logic [XBAR_NSLAVE-1:0][1:0] max_prio;
+
+  assign eligible = req_i & ~capped;
+
+  always_comb begin
+    max_prio = '0;
+    for (int unsigned i = 0; i < XBAR_NMASTER; i++) begin
+      if (eligible[i] && prio_i[i] > max_prio[port_sel_i[i]]) max_prio[port_sel_i[i]] = prio_i[i];
+    end
+  end
+
+  for (genvar i = 0; i < XBAR_NMASTER; i++) begin : gen_req
+    assign req_o[i] = eligible[i] && (prio_i[i] == max_prio[port_sel_i[i]]);
+  end
+
+  //Weighted round robin: top_q is the master with the highest priority, it moves
+  //to the next master after a grant (after weight+1 consecutive grants)
+  logic [XBAR_NSLAVE-1:0][LogNMaster-1:0] top_q;
+  logic [XBAR_NSLAVE-1:0][3:0] credit_q;
+
+  for (genvar k = 0; k < XBAR_NSLAVE; k++) begin : gen_rr
+    //rr_arb_tree gives the highest priority to rr_i itself
+    assign rr_o[k] = top_q[k];
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      top_q    <= '0;
+      credit_q <= '0;
+    end else begin
+      for (int unsigned i = 0; i < XBAR_NMASTER; i++) begin
+        if (req_o[i] && gnt_i[i]) begin
+          if ((top_q[port_sel_i[i]] == i) && (credit_q[port_sel_i[i]] < weight_i[i])) begin
+            credit_q[port_sel_i[i]] <= credit_q[port_sel_i[i]] + 4'd1;
+          end else if ((top_q[port_sel_i[i]] != i) && (weight_i[i] != '0)) begin
+            top_q[port_sel_i[i]]    <= LogNMaster'(i);
+            credit_q[port_sel_i[i]] <= 4'd1;
+          end else begin
+            top_q[port_sel_i[i]]    <= (i == XBAR_NMASTER - 1) ? '0 : LogNMaster'(i + 1);
+            credit_q[port_sel_i[i]] <= '0;
+          end
+        end
+      end
+    end
+  end
+
+endmodule
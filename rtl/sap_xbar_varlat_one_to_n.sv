@@ -13,7 +13,7 @@
 module sap_xbar_varlat_one_to_n #(
     parameter int unsigned XBAR_NSLAVE = 2,
     parameter int unsigned NUM_RULES = XBAR_NSLAVE,  // number of ranges in the address map
-    parameter int unsigned AGGREGATE_GNT = 32'd1, // the master port is not aggregating multiple masters
+    parameter int unsigned MAX_OUTSTANDING = 32'd2, // in-order transactions in flight to the same slave
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
     // Dependent parameters: do not override!
@@ -44,33 +44,10 @@ module sap_xbar_varlat_one_to_n #(
   // MASTER <--> XBAR --- SLAVE[...]
   //                `---- SLAVE[XBAR_NSLAVE-1]
 
-  // PARAMETERS
-  // ----------
-  // Slave index width
-  localparam int unsigned LogXbarNSlave = XBAR_NSLAVE > 1 ? $clog2(XBAR_NSLAVE) : 32'd1;
-
-  // Data width
-  // Request: we + be[3:0] + addr[31:0] + wdata[31:0]
-  localparam int unsigned ReqDataWidth = 32'd1 + 32'd4 + 32'd32 + 32'd32;
-  // Response: rdata[31:0]
-  localparam int unsigned RspDataWidth = 32'd32;
-
   // INTERNAL SIGNALS
   // ----------------
   // Selected slave index
-  logic [LogXbarNSlave-1:0]                   slave_idx;
-
-  // Crossbar input and output data
-  logic [              0:0]                   master_xbar_req_req;
-  logic [              0:0]                   xbar_master_rsp_gnt;
-  logic [              0:0]                   xbar_master_rsp_rvalid;
-  logic [              0:0][ReqDataWidth-1:0] master_xbar_req_data;
-  logic [              0:0][RspDataWidth-1:0] xbar_master_rsp_data;
-  logic [  XBAR_NSLAVE-1:0]                   xbar_slave_req_req;
-  logic [  XBAR_NSLAVE-1:0]                   slave_xbar_rsp_gnt;
-  logic [  XBAR_NSLAVE-1:0]                   slave_xbar_rsp_rvalid;
-  logic [  XBAR_NSLAVE-1:0][ReqDataWidth-1:0] xbar_slave_req_data;
-  logic [  XBAR_NSLAVE-1:0][RspDataWidth-1:0] slave_xbar_rsp_data;
+  logic [IdxWidth-1:0] slave_idx;
 
   // ----------------
   // INTERNAL MODULES
@@ -97,59 +74,21 @@ module sap_xbar_varlat_one_to_n #(
       .default_idx_i   (default_idx_i)
   );
 
-  // 1-to-N crossbar
-  // ---------------
-  // Unroll OBI master signals
-  assign master_xbar_req_req[0] = master_req_i.req;
-  assign master_xbar_req_data[0] = {
-    master_req_i.we, master_req_i.be, master_req_i.addr, master_req_i.wdata
-  };
-  assign master_resp_o = '{
-          gnt: xbar_master_rsp_gnt[0],
-          rvalid: xbar_master_rsp_rvalid[0],
-          rdata: xbar_master_rsp_data[0]
-      };
-
-  // Unroll OBI slave signals
-  generate
-    for (genvar i = 0; unsigned'(i) < XBAR_NSLAVE; i++) begin : gen_unroll_obi
-      assign slave_req_o[i].req = xbar_slave_req_req[i];
-      assign {
-        slave_req_o[i].we,
-        slave_req_o[i].be,
-        slave_req_o[i].addr,
-        slave_req_o[i].wdata
-      } = xbar_slave_req_data[i];
-      assign {
-        slave_xbar_rsp_gnt[i],
-        slave_xbar_rsp_rvalid[i],
-        slave_xbar_rsp_data[i]
-      } = slave_resp_i[i];
-    end
-  endgenerate
-
-  // Instantiate crossbar
-  xbar_varlat #(
-      .AggregateGnt (AGGREGATE_GNT),
-      .NumIn        (32'd1),
-      .NumOut       (XBAR_NSLAVE),
-      .ReqDataWidth (ReqDataWidth),
-      .RespDataWidth(RspDataWidth),
-      .ExtPrio      (1'b0)            // do not use external arbiter priority
-  ) u_xbar_varlat (
-      .clk_i  (clk_i),
-      .rst_ni (rst_ni),
-      .rr_i   ('0),
-      .req_i  (master_xbar_req_req),
-      .add_i  (slave_idx),
-      .wdata_i(master_xbar_req_data),
-      .gnt_o  (xbar_master_rsp_gnt),
-      .vld_o  (xbar_master_rsp_rvalid),
-      .rdata_o(xbar_master_rsp_data),
-      .gnt_i  (slave_xbar_rsp_gnt),
-      .req_o  (xbar_slave_req_req),
-      .vld_i  (slave_xbar_rsp_rvalid),
-      .wdata_o(xbar_slave_req_data),
-      .rdata_i(slave_xbar_rsp_data)
+  // 1-to-N demux
+  // ------------
+  // Multiple outstanding transactions are tracked in order (see sap_xbar_demux)
+  sap_xbar_demux #(
+      .obi_req_t      (obi_req_t),
+      .obi_resp_t     (obi_resp_t),
+      .XBAR_NSLAVE    (XBAR_NSLAVE),
+      .MAX_OUTSTANDING(MAX_OUTSTANDING)
+  ) u_demux (
+      .clk_i        (clk_i),
+      .rst_ni       (rst_ni),
+      .port_sel_i   (slave_idx),
+      .master_req_i (master_req_i),
+      .master_resp_o(master_resp_o),
+      .slave_req_o  (slave_req_o),
+      .slave_resp_i (slave_resp_i)
   );
 endmodule
@@ -0,0 +1,60 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// Per-word valid flags of the safe copy for the fast sync (Sync_Ctrl.FAST).
+//  - A flag is set when the master store to that word of the safe copy
+//    (Safe_Activate context, NWORDS words from base_i) is granted.
+//  - While track_i, a load of a slave from a word not yet valid is held
+//    (hold_o gates its request and grant), so halt_boot restores the context
+//    in parallel with the master storing it.
+//  - clear_i (outside TMR_MODE/DMR_MODE) clears the flags for the next entry.
+
+module sync_track #(
+    parameter type obi_req_t = logic,
+    parameter NHARTS = 3,
+    parameter int unsigned NWORDS = 37
+) (
+    input logic clk_i,
+    input logic rst_ni,
+
+    input logic clear_i,
+    input logic track_i,
+    input logic [31:0] base_i,
+    input logic [NHARTS-1:0] master_i,
+
+    // Hart side data requests
+    input obi_req_t [NHARTS-1:0] core_data_req_i,
+    input logic [NHARTS-1:0] core_data_gnt_i,
+
+    output logic [NHARTS-1:0] hold_o
+);
+
+  logic [NWORDS-1:0] valid_q;
+
+  function automatic logic in_copy(logic [31:0] addr, logic [31:0] base);
+    return (addr >= base) && (addr < base + 4 * NWORDS);
+  endfunction
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin
+    if (!rst_ni) begin
+      valid_q <= '0;
+    end else if (clear_i) begin
+      valid_q <= '0;
+    end else begin
+      for (int unsigned i = 0; i < NHARTS; i++) begin
+        if (master_i[i] && core_data_req_i[i].req && core_data_req_i[i].we && core_data_gnt_i[i] &&
+            in_copy(core_data_req_i[i].addr, base_i))
+          valid_q[(core_data_req_i[i].addr-base_i)>>2] <= 1'b1;
+      end
+    end
+  end
+
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_hold
+    assign hold_o[i] = track_i && !master_i[i] && core_data_req_i[i].req && !core_data_req_i[i].we &&
+                       in_copy(core_data_req_i[i].addr, base_i) &&
+                       !valid_q[(core_data_req_i[i].addr-base_i)>>2];
+  end
+
+endmodule
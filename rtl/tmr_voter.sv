@@ -3,9 +3,18 @@
 // SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
 // Luis Waucquez (luis.waucquez.jimenez@upm.es)
 /*
- *
- *
- *
+ * Bitwise majority voter for the instruction and data requests of the three
+ * harts. With PIPELINE the voted request and the error flags are registered
+ * (obi_sngreg): one more cycle of request latency, the harts are granted by
+ * the stage (core_*_gnt_o) instead of the bus. enable_i low clears the
+ * stage: safe_cpu_group keeps it high until the stage is empty and nothing is
+ * in flight, so a request granted to the harts is never dropped. error_field_o tells which
+ * fields of each hart differ from the voted request ({wdata, be, we, addr,
+ * req}) and error_addr_o the voted address of the erroneous bus (telemetry).
+ * Outside critical sections check_policy may leave the addr, be and wdata of
+ * a transaction unchecked (instr_check_i/data_check_i, load_check_i low: data
+ * bus checked on stores only); it is still voted and forwarded. req and we,
+ * hence the store decision, are always checked.
  */
 
 module tmr_voter
@@ -13,25 +22,48 @@ module tmr_voter
 #(
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
-    parameter NHARTS = 3
+    parameter NHARTS = 3,
+    parameter bit PIPELINE = sap_pkg::VOTER_PIPELINE
 ) (
+    input logic clk_i,
+    input logic rst_ni,
+
     // Instruction Bus
     input obi_req_t [NHARTS-1 : 0] core_instr_req_i,
     output obi_req_t voted_core_instr_req_o,
+    input logic voted_core_instr_gnt_i,
+    output logic core_instr_gnt_o,
 
     // Data Bus
     input obi_req_t [NHARTS-1 : 0] core_data_req_i,
     output obi_req_t voted_core_data_req_o,
+    input logic voted_core_data_gnt_i,
+    output logic core_data_gnt_o,
 
     input logic enable_i,
 
+    // Relaxed checking
+    input logic instr_check_i,
+    input logic data_check_i,
+    input logic load_check_i,
+
     output logic error_o,
-    output [NHARTS-1:0] error_id_o
+    output logic [NHARTS-1:0] error_id_o,
+    output logic [NHARTS-1:0][4:0] error_field_o,
+    output logic [31:0] error_addr_o
 );
 
   logic [5:0] error_s;
   logic [NHARTS-1:0] instr_error_s;
   logic [NHARTS-1:0] data_error_s;
+  logic error_o_s;
+  logic [NHARTS-1:0] error_id_o_s;
+  logic [NHARTS-1:0][4:0] instr_field_s;
+  logic [NHARTS-1:0][4:0] data_field_s;
+  logic [NHARTS-1:0][4:0] error_field_o_s;
+  logic [31:0] error_addr_o_s;
+  logic data_store_s;
+  logic data_check_s;
 
   obi_req_t voted_core_instr_req_s;
   obi_req_t voted_core_data_req_s;
@@ -82,6 +114,13 @@ module tmr_voter
 
 
   // Checker
+  always_comb begin
+    data_store_s = 1'b0;
+    for (int i = 0; i < NHARTS; i++) data_store_s |= core_data_req_i[i].req & core_data_req_i[i].we;
+  end
+
+  assign data_check_s = data_check_i && (load_check_i || data_store_s);
+
   always_comb begin
     instr_error_s = '0;
     data_error_s = '0;
@@ -90,11 +129,14 @@ module tmr_voter
     //Instruction
     //Added check for req addr or wdata
     for (int i = 0; i < NHARTS; i++) begin : instr_bus_checker
-      if ((((voted_core_instr_req_s.addr != core_instr_req_i[i].addr) & core_instr_req_i[i].req) ||
-            ((voted_core_instr_req_s.wdata != core_instr_req_i[i].wdata) & core_instr_req_i[i].we) ||
-            (voted_core_instr_req_s.be != core_instr_req_i[i].be) ||
-            (voted_core_instr_req_s.we != core_instr_req_i[i].we) ||
-            (voted_core_instr_req_s.req != core_instr_req_i[i].req)) && enable_i) begin
+      instr_field_s[i] = {
+        (voted_core_instr_req_s.wdata != core_instr_req_i[i].wdata) & core_instr_req_i[i].we,
+        (voted_core_instr_req_s.be != core_instr_req_i[i].be),
+        (voted_core_instr_req_s.we != core_instr_req_i[i].we),
+        (voted_core_instr_req_s.addr != core_instr_req_i[i].addr) & core_instr_req_i[i].req,
+        (voted_core_instr_req_s.req != core_instr_req_i[i].req)
+      } & {{2{instr_check_i}}, 1'b1, instr_check_i, 1'b1} & {5{enable_i}};
+      if (|instr_field_s[i]) begin
         instr_error_s[i] = 1'b1;
         error_s[i] = 1'b1;
       end
@@ -103,25 +145,82 @@ module tmr_voter
     //Data
     //Added check for req addr or wdata
     for (int i = 0; i < NHARTS; i++) begin : data_bus_checker
-      if ((((voted_core_data_req_s.addr != core_data_req_i[i].addr) & core_data_req_i[i].req) ||
-            ((voted_core_data_req_s.wdata != core_data_req_i[i].wdata) & core_data_req_i[i].we) ||
-            (voted_core_data_req_s.be != core_data_req_i[i].be) ||
-            (voted_core_data_req_s.we != core_data_req_i[i].we) ||
-            (voted_core_data_req_s.req != core_data_req_i[i].req)) && enable_i) begin
+      data_field_s[i] = {
+        (voted_core_data_req_s.wdata != core_data_req_i[i].wdata) & core_data_req_i[i].we,
+        (voted_core_data_req_s.be != core_data_req_i[i].be),
+        (voted_core_data_req_s.we != core_data_req_i[i].we),
+        (voted_core_data_req_s.addr != core_data_req_i[i].addr) & core_data_req_i[i].req,
+        (voted_core_data_req_s.req != core_data_req_i[i].req)
+      } & {{2{data_check_s}}, 1'b1, data_check_s, 1'b1} & {5{enable_i}};
+      if (|data_field_s[i]) begin
         data_error_s[i] = 1'b1;
         error_s[3+i] = 1'b1;
       end
     end
   end
 
-
-  assign error_id_o = instr_error_s | data_error_s;
+  assign error_id_o_s = instr_error_s | data_error_s;
   //Error is issued only under request
-  assign error_o = ((error_s[0] | error_s[1] | error_s[2]) & voted_core_instr_req_s.req) | ((error_s[3] | error_s[4] | error_s[5]) & voted_core_data_req_s.req);
+  assign error_o_s = ((error_s[0] | error_s[1] | error_s[2]) & voted_core_instr_req_s.req) | ((error_s[3] | error_s[4] | error_s[5]) & voted_core_data_req_s.req);
 
-  assign voted_core_instr_req_o = voted_core_instr_req_s;
-  assign voted_core_data_req_o = voted_core_data_req_s;
+  //Telemetry: same qualification as error_o
+  for (genvar i = 0; i < NHARTS; i++) begin : gen_error_field
+    assign error_field_o_s[i] = (instr_field_s[i] & {5{voted_core_instr_req_s.req}}) |
+                                (data_field_s[i] & {5{voted_core_data_req_s.req}});
+  end
+  assign error_addr_o_s = ((|data_error_s) && voted_core_data_req_s.req) ? voted_core_data_req_s.addr :
+                                                                           voted_core_instr_req_s.addr;
+
+  if (PIPELINE) begin : gen_pipeline
+    //Register stage: voted request and error flags, the harts are granted by the stage
+    obi_sngreg #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t)
+    ) obi_sngreg_instr_i (
+        .clk_i,
+        .rst_ni,
+        .clear_pipeline       (~enable_i),
+        .core_instr_req_i     (voted_core_instr_req_s),
+        .core_instr_req_o     (voted_core_instr_req_o),
+        .core_instr_resp_gnt_i(voted_core_instr_gnt_i),
+        .core_instr_resp_gnt_o(core_instr_gnt_o)
+    );
+
+    obi_sngreg #(
+        .obi_req_t (obi_req_t),
+        .obi_resp_t(obi_resp_t)
+    ) obi_sngreg_data_i (
+        .clk_i,
+        .rst_ni,
+        .clear_pipeline       (~enable_i),
+        .core_instr_req_i     (voted_core_data_req_s),
+        .core_instr_req_o     (voted_core_data_req_o),
+        .core_instr_resp_gnt_i(voted_core_data_gnt_i),
+        .core_instr_resp_gnt_o(core_data_gnt_o)
+    );
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin
+      if (!rst_ni) begin
+        error_o       <= 1'b0;
+        error_id_o    <= '0;
+        error_field_o <= '0;
+        error_addr_o  <= '0;
+      end else begin
+        error_o       <= error_o_s;
+        error_id_o    <= error_id_o_s;
+        error_field_o <= error_field_o_s;
+        error_addr_o  <= error_addr_o_s;
+      end
+    end
+  end else begin : gen_no_pipeline
+    assign voted_core_instr_req_o = voted_core_instr_req_s;
+    assign voted_core_data_req_o = voted_core_data_req_s;
+    assign core_instr_gnt_o = voted_core_instr_gnt_i;
+    assign core_data_gnt_o = voted_core_data_gnt_i;
+    assign error_o = error_o_s;
+    assign error_id_o = error_id_o_s;
+    assign error_field_o = error_field_o_s;
+    assign error_addr_o = error_addr_o_s;
+  end
 
 endmodule
-
-
@@ -12,6 +12,17 @@ module xbar_system
     parameter sap_pkg::bus_type_e BUS_TYPE = sap_pkg::BusType,
     parameter XBAR_NMASTER = 3,
     parameter XBAR_NSLAVE = 6,
+    parameter NUM_RULES = XBAR_NSLAVE,
+    //RAM banks: slaves [MEM_IDX, MEM_IDX+MEM_BANKS), port B of dual port
+    //banks at [MEM_IDX+MEM_BANKS, MEM_IDX+2*MEM_BANKS) (no address rule)
+    parameter sap_pkg::mem_layout_e MEM_LAYOUT = sap_pkg::MemLayout,
+    parameter int unsigned MEM_IDX = sap_pkg::MEMORY_RAM0_IDX,
+    parameter int unsigned MEM_BANKS = sap_pkg::NUM_BANKS,
+    parameter int unsigned MEM_LINE_WORDS = sap_pkg::MEM_LINE_WORDS,
+    parameter int unsigned MEM_PORTS = sap_pkg::MEM_PORTS,
+    parameter logic [XBAR_NMASTER-1:0] MEM_PORTB_MASTERS = sap_pkg::MEM_PORTB_MASTERS,
+    //In-order transactions in flight per master and per slave
+    parameter int unsigned MAX_OUTSTANDING = sap_pkg::XBAR_MAX_OUTSTANDING,
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic,
     localparam int unsigned IdxWidth = cf_math_pkg::idx_width(XBAR_NSLAVE)
@@ -20,11 +31,17 @@ module xbar_system
     input logic rst_ni,
 
     // Address map
-    input addr_map_rule_pkg::addr_map_rule_t [XBAR_NSLAVE-1:0] addr_map_i,
+    input addr_map_rule_pkg::addr_map_rule_t [NUM_RULES-1:0] addr_map_i,
 
     // Default slave index
     input logic [IdxWidth-1:0] default_idx_i,
 
+    // QoS (see sap_xbar_qos)
+    input logic [XBAR_NMASTER-1:0][1:0] qos_prio_i,
+    input logic [XBAR_NMASTER-1:0][3:0] qos_weight_i,
+    input logic [15:0] qos_bw_window_i,
+    input logic [XBAR_NMASTER-1:0][7:0] qos_bw_cap_i,
+
     input  obi_req_t  [XBAR_NMASTER-1:0] master_req_i,
     output obi_resp_t [XBAR_NMASTER-1:0] master_resp_o,
 
@@ -33,60 +50,82 @@ module xbar_system
 
 );
 
-  //localparam int unsigned LOG_XBAR_NMASTER = XBAR_NMASTER > 1 ? $clog2(XBAR_NMASTER) : 32'd1;
+  localparam int unsigned LOG_XBAR_NMASTER = XBAR_NMASTER > 1 ? $clog2(XBAR_NMASTER) : 32'd1;
   localparam int unsigned LOG_XBAR_NSLAVE = XBAR_NSLAVE > 1 ? $clog2(XBAR_NSLAVE) : 32'd1;
-
-  //Aggregated Request Data (from Master -> slaves)
-  //WE + BE + ADDR + WDATA
-  localparam int unsigned REQ_AGG_DATA_WIDTH = 1 + 4 + 32 + 32;
-  localparam int unsigned RESP_AGG_DATA_WIDTH = 32;
+  localparam int unsigned LOG_MEM_BANKS = MEM_BANKS > 1 ? $clog2(MEM_BANKS) : 32'd1;
+  //Lowest address bit of the bank select when interleaved
+  localparam int unsigned IL_LSB = (MEM_LAYOUT == LINE_INTERLEAVED) ? 2 + $clog2(MEM_LINE_WORDS) : 2;
 
   //Address Decoder
+  logic [XBAR_NMASTER-1:0][LOG_XBAR_NSLAVE-1:0] pre_port_sel;
+  logic [XBAR_NMASTER-1:0][LOG_XBAR_NSLAVE-1:0] bank_port_sel;
   logic [XBAR_NMASTER-1:0][LOG_XBAR_NSLAVE-1:0] port_sel;
+  logic [XBAR_NMASTER-1:0] mem_hit;
 
   logic [XBAR_NMASTER-1:0] master_req_req;
   logic [XBAR_NMASTER-1:0] master_resp_gnt;
-  logic [XBAR_NMASTER-1:0] master_resp_rvalid;
-  logic [XBAR_NMASTER-1:0][31:0] master_resp_rdata;
 
-  logic [XBAR_NSLAVE-1:0] slave_req_req;
-  logic [XBAR_NSLAVE-1:0] slave_resp_gnt;
-  logic [XBAR_NSLAVE-1:0] slave_resp_rvalid;
-  logic [XBAR_NSLAVE-1:0][31:0] slave_resp_rdata;
+  obi_req_t [XBAR_NMASTER-1:0] master_req;
+
+  //Slave index of every master (both bus types)
+  for (genvar i = 0; i < XBAR_NMASTER; i++) begin : gen_addr_decoders
+    addr_decode #(
+        /// Highest index which can happen in a rule.
+        .NoIndices(XBAR_NSLAVE),
+        .NoRules(NUM_RULES),
+        .addr_t(logic [31:0]),
+        .rule_t(addr_map_rule_pkg::addr_map_rule_t)
+    ) addr_decode_i (
+        .addr_i(master_req_i[i].addr),
+        .addr_map_i,
+        .idx_o(pre_port_sel[i]),
+        .dec_valid_o(),
+        .dec_error_o(),
+        .en_default_idx_i(1'b1),
+        .default_idx_i
+    );
 
+    assign mem_hit[i] = (pre_port_sel[i] >= MEM_IDX) && (pre_port_sel[i] < MEM_IDX + MEM_BANKS);
 
-  logic [XBAR_NMASTER-1:0][REQ_AGG_DATA_WIDTH-1:0] master_req_data;
-  logic [XBAR_NSLAVE-1:0][REQ_AGG_DATA_WIDTH-1:0] slave_req_out_data;
-  obi_req_t [XBAR_NMASTER-1:0] master_req;
+    // Interleaved banks: the bank is selected by the low address bits
+    if (MEM_LAYOUT == CONTIGUOUS) begin : gen_contiguous
+      assign bank_port_sel[i] = pre_port_sel[i];
+    end else begin : gen_interleaved
+      assign bank_port_sel[i] = mem_hit[i] ?
+          LOG_XBAR_NSLAVE'(MEM_IDX + master_req_i[i].addr[IL_LSB+:LOG_MEM_BANKS]) :
+          pre_port_sel[i];
+    end
 
-  if (BUS_TYPE == NtoM) begin : gen_addr_decoders_NtoM
-    for (genvar i = 0; i < XBAR_NMASTER; i++) begin : gen_addr_decoders
-      addr_decode #(
-          /// Highest index which can happen in a rule.
-          .NoIndices(XBAR_NSLAVE),
-          .NoRules(XBAR_NSLAVE),
-          .addr_t(logic [31:0]),
-          .rule_t(addr_map_rule_pkg::addr_map_rule_t)
-      ) addr_decode_i (
-          .addr_i(master_req_i[i].addr),
-          .addr_map_i,
-          .idx_o(port_sel[i]),
-          .dec_valid_o(),
-          .dec_error_o(),
-          .en_default_idx_i(1'b1),
-          .default_idx_i
-      );
+    // Dual port banks: port B masters use the second slave port of the bank
+    if (MEM_PORTS == 2 && MEM_PORTB_MASTERS[i]) begin : gen_port_b
+      assign port_sel[i] = mem_hit[i] ? bank_port_sel[i] + LOG_XBAR_NSLAVE'(MEM_BANKS) :
+          bank_port_sel[i];
+    end else begin : gen_port_a
+      assign port_sel[i] = bank_port_sel[i];
     end
   end
 
   // Propagate interleaved address
+  // The bank select bits are removed so each bank sees a contiguous word address
+  logic [XBAR_NMASTER-1:0][31:0] master_addr;
+
   generate
     for (genvar i = 0; i < XBAR_NMASTER; i++) begin : gen_unroll_master
+      if (MEM_LAYOUT == CONTIGUOUS) begin : gen_contiguous
+        assign master_addr[i] = master_req_i[i].addr;
+      end else begin : gen_interleaved
+        assign master_addr[i] = mem_hit[i] ? {
+          {LOG_MEM_BANKS{1'b0}},
+          master_req_i[i].addr[31:IL_LSB+LOG_MEM_BANKS],
+          master_req_i[i].addr[IL_LSB-1:0]
+        } : master_req_i[i].addr;
+      end
+
       assign master_req[i] = '{
               req: master_req_i[i].req,
               we: master_req_i[i].we,
               be: master_req_i[i].be,
-              addr: master_req_i[i].addr,
+              addr: master_addr[i],
               wdata: master_req_i[i].wdata
           };
     end
@@ -94,78 +133,188 @@ module xbar_system
 
   if (BUS_TYPE == NtoM) begin : gen_xbar_NtoM
 
+    // ARCHITECTURE
+    // ------------
+    // MASTER[i] <--> DEMUX[i] --- QoS --- MUX[k] <--> SLAVE[k]
+    // Each demux tracks its outstanding transactions (same slave, in order)
+    // and each slave mux queues the master index of every granted request.
+    obi_req_t  [XBAR_NMASTER-1:0][XBAR_NSLAVE-1:0] demux_req;
+    obi_resp_t [XBAR_NMASTER-1:0][XBAR_NSLAVE-1:0] demux_resp;
+    obi_req_t  [XBAR_NSLAVE-1:0][XBAR_NMASTER-1:0] mux_req;
+    obi_resp_t [XBAR_NSLAVE-1:0][XBAR_NMASTER-1:0] mux_resp;
 
-    // Unroll OBI structs
-    for (genvar i = 0; unsigned'(i) < XBAR_NMASTER; i++) begin : gen_unroll_master
-      assign master_req_req[i] = master_req[i].req;
-      assign master_req_data[i] = {
-        master_req[i].we, master_req[i].be, master_req[i].addr, master_req[i].wdata
-      };
-      assign master_resp_o[i].gnt = master_resp_gnt[i];
-      assign master_resp_o[i].rdata = master_resp_rdata[i];
-      assign master_resp_o[i].rvalid = master_resp_rvalid[i];
-    end
+    //QoS: priority, weighted round robin and bandwidth caps
+    logic [XBAR_NMASTER-1:0] qos_req;
+    logic [XBAR_NSLAVE-1:0][LOG_XBAR_NMASTER-1:0] qos_rr;
+
+    for (genvar i = 0; unsigned'(i) < XBAR_NMASTER; i++) begin : gen_demux
+      sap_xbar_demux #(
+          .obi_req_t      (obi_req_t),
+          .obi_resp_t     (obi_resp_t),
+          .XBAR_NSLAVE    (XBAR_NSLAVE),
+          .MAX_OUTSTANDING(MAX_OUTSTANDING)
+      ) demux_i (
+          .clk_i,
+          .rst_ni,
+          .port_sel_i   (port_sel[i]),
+          .master_req_i (master_req[i]),
+          .master_resp_o(master_resp_o[i]),
+          .slave_req_o  (demux_req[i]),
+          .slave_resp_i (demux_resp[i])
+      );
+
+      //Only requests the demux lets through compete for the slave
+      assign master_req_req[i]  = demux_req[i][port_sel[i]].req;
+      assign master_resp_gnt[i] = master_resp_o[i].gnt;
 
-    for (genvar i = 0; i < XBAR_NSLAVE; i++) begin : gen_unroll_slave
-      assign slave_req_o[i].req = slave_req_req[i];
-      assign {slave_req_o[i].we, slave_req_o[i].be, slave_req_o[i].addr, slave_req_o[i].wdata} = slave_req_out_data[i];
-      assign slave_resp_rdata[i] = slave_resp_i[i].rdata;
-      assign slave_resp_gnt[i] = slave_resp_i[i].gnt;
-      assign slave_resp_rvalid[i] = slave_resp_i[i].rvalid;
+      for (genvar k = 0; unsigned'(k) < XBAR_NSLAVE; k++) begin : gen_reshape
+        always_comb begin
+          mux_req[k][i]     = demux_req[i][k];
+          mux_req[k][i].req = demux_req[i][k].req && qos_req[i];
+        end
+        assign demux_resp[i][k] = mux_resp[k][i];
+      end
     end
 
-    //Crossbar instantiation
-    xbar_varlat #(
-        .AggregateGnt(1),
-        .NumIn(XBAR_NMASTER),
-        .NumOut(XBAR_NSLAVE),
-        .ReqDataWidth(REQ_AGG_DATA_WIDTH),
-        .RespDataWidth(RESP_AGG_DATA_WIDTH)
-    ) i_xbar (
+    sap_xbar_qos #(
+        .XBAR_NMASTER(XBAR_NMASTER),
+        .XBAR_NSLAVE (XBAR_NSLAVE)
+    ) sap_xbar_qos_i (
         .clk_i,
         .rst_ni,
-        .req_i  (master_req_req),
-        .add_i  (port_sel),
-        .wdata_i(master_req_data),
-        .gnt_o  (master_resp_gnt),
-        .rdata_o(master_resp_rdata),
-        .rr_i   ('0),
-        .vld_o  (master_resp_rvalid),
-        .gnt_i  (slave_resp_gnt),
-        .req_o  (slave_req_req),
-        .vld_i  (slave_resp_rvalid),
-        .wdata_o(slave_req_out_data),
-        .rdata_i(slave_resp_rdata)
+        .prio_i     (qos_prio_i),
+        .weight_i   (qos_weight_i),
+        .bw_window_i(qos_bw_window_i),
+        .bw_cap_i   (qos_bw_cap_i),
+        .req_i      (master_req_req),
+        .port_sel_i (port_sel),
+        .gnt_i      (master_resp_gnt),
+        .req_o      (qos_req),
+        .rr_o       (qos_rr)
     );
 
+    for (genvar k = 0; unsigned'(k) < XBAR_NSLAVE; k++) begin : gen_mux
+      sap_xbar_varlat_n_to_one #(
+          .obi_req_t      (obi_req_t),
+          .obi_resp_t     (obi_resp_t),
+          .XBAR_NMASTER   (XBAR_NMASTER),
+          .MAX_OUTSTANDING(MAX_OUTSTANDING),
+          .EXT_PRIO       (1'b1)
+      ) mux_i (
+          .clk_i,
+          .rst_ni,
+          .rr_i         (qos_rr[k]),
+          .master_req_i (mux_req[k]),
+          .master_resp_o(mux_resp[k]),
+          .slave_req_o  (slave_req_o[k]),
+          .slave_resp_i (slave_resp_i[k])
+      );
+    end
+
   end else begin : gen_xbar_1toM
-    // Neck crossbar
-    obi_req_t  neck_req;
+
+    // ARCHITECTURE
+    // ------------
+    // MASTER[i] --- QoS --- ARBITER <--> NECK <--> DEMUX <--> SLAVE[k]
+    // Shared bus, one request per cycle. The slave index decoded on the master
+    // side (interleaving and port B included) travels with the request, and
+    // the master index of every granted request is queued to route the
+    // in-order responses back.
+    localparam int unsigned ReqDataWidth = LOG_XBAR_NSLAVE + 32'd1 + 32'd4 + 32'd32 + 32'd32;
+    localparam int unsigned IdWidth = cf_math_pkg::idx_width(XBAR_NMASTER);
+
+    logic [XBAR_NMASTER-1:0] qos_req, arb_gnt;
+    logic [0:0][LOG_XBAR_NMASTER-1:0] qos_rr;
+    logic [XBAR_NMASTER-1:0][ReqDataWidth-1:0] master_req_data;
+    logic [ReqDataWidth-1:0] arb_data;
+    logic arb_req;
+    logic [IdWidth-1:0] arb_idx;
+
+    obi_req_t neck_req;
     obi_resp_t neck_resp;
-    // N-to-1 crossbar
-    sap_xbar_varlat_n_to_one #(
-        .obi_req_t            (obi_req_t  ),
-        .obi_resp_t           (obi_resp_t ),
-        .XBAR_NMASTER(XBAR_NMASTER)
-    ) sap_xbar_varlat_n_to_one_i (
-        .clk_i        (clk_i),
-        .rst_ni       (rst_ni),
-        .master_req_i (master_req),
-        .master_resp_o(master_resp_o),
-        .slave_req_o  (neck_req),
-        .slave_resp_i (neck_resp)
+    logic [LOG_XBAR_NSLAVE-1:0] neck_sel;
+
+    logic id_full, id_empty;
+    logic [IdWidth-1:0] id_head;
+
+    for (genvar i = 0; unsigned'(i) < XBAR_NMASTER; i++) begin : gen_master
+      assign master_req_req[i]  = master_req[i].req;
+      assign master_resp_gnt[i] = master_resp_o[i].gnt;
+      assign master_req_data[i] = {
+        port_sel[i], master_req[i].we, master_req[i].be, master_req[i].addr, master_req[i].wdata
+      };
+      assign master_resp_o[i] = '{
+              gnt: arb_gnt[i],
+              rvalid: neck_resp.rvalid && !id_empty && (id_head == i),
+              rdata: neck_resp.rdata
+          };
+    end
+
+    //QoS: the whole bus is a single arbitration point
+    sap_xbar_qos #(
+        .XBAR_NMASTER(XBAR_NMASTER),
+        .XBAR_NSLAVE (1)
+    ) sap_xbar_qos_i (
+        .clk_i,
+        .rst_ni,
+        .prio_i     (qos_prio_i),
+        .weight_i   (qos_weight_i),
+        .bw_window_i(qos_bw_window_i),
+        .bw_cap_i   (qos_bw_cap_i),
+        .req_i      (master_req_req),
+        .port_sel_i ('0),
+        .gnt_i      (master_resp_gnt),
+        .req_o      (qos_req),
+        .rr_o       (qos_rr)
     );
 
-    sap_xbar_varlat_one_to_n #(
-        .obi_req_t            (obi_req_t  ),
-        .obi_resp_t           (obi_resp_t ),
-        .XBAR_NSLAVE   (XBAR_NSLAVE),
-        .AGGREGATE_GNT (32'd0) // the neck request is aggregating all the input masters
-    ) sap_xbar_varlat_one_to_n_i (
-        .clk_i        (clk_i),
-        .rst_ni       (rst_ni),
-        .addr_map_i,
-        .default_idx_i,
+    rr_arb_tree #(
+        .NumIn    (XBAR_NMASTER),
+        .DataWidth(ReqDataWidth),
+        .ExtPrio  (1'b1)
+    ) arb_i (
+        .clk_i  (clk_i),
+        .rst_ni (rst_ni),
+        .flush_i(1'b0),
+        .rr_i   (qos_rr[0]),
+        .req_i  (qos_req),
+        .gnt_o  (arb_gnt),
+        .data_i (master_req_data),
+        .gnt_i  (neck_resp.gnt && !id_full),
+        .req_o  (arb_req),
+        .data_o (arb_data),
+        .idx_o  (arb_idx)
+    );
+
+    assign neck_req.req = arb_req && !id_full;
+    assign {neck_sel, neck_req.we, neck_req.be, neck_req.addr, neck_req.wdata} = arb_data;
+
+    fifo_v3 #(
+        .DATA_WIDTH(IdWidth),
+        .DEPTH     (MAX_OUTSTANDING)
+    ) id_fifo_i (
+        .clk_i     (clk_i),
+        .rst_ni    (rst_ni),
+        .flush_i   (1'b0),
+        .testmode_i(1'b0),
+        .full_o    (id_full),
+        .empty_o   (id_empty),
+        .usage_o   (),
+        .data_i    (arb_idx),
+        .push_i    (neck_req.req && neck_resp.gnt),
+        .data_o    (id_head),
+        .pop_i     (neck_resp.rvalid && !id_empty)
+    );
+
+    sap_xbar_demux #(
+        .obi_req_t      (obi_req_t),
+        .obi_resp_t     (obi_resp_t),
+        .XBAR_NSLAVE    (XBAR_NSLAVE),
+        .MAX_OUTSTANDING(MAX_OUTSTANDING)
+    ) demux_i (
+        .clk_i,
+        .rst_ni,
+        .port_sel_i   (neck_sel),
         .master_req_i (neck_req),
         .master_resp_o(neck_resp),
         .slave_req_o  (slave_req_o),
@@ -6,29 +6,31 @@
 module sram_wrapper #(
     parameter int unsigned NumWords = 32'd1024,  // Number of Words in data array
     parameter int unsigned DataWidth = 32'd32,  // Data signal width
+    parameter int unsigned NumPorts = 32'd1,  // 1 or 2 (true dual port)
     // DEPENDENT PARAMETERS, DO NOT OVERWRITE!
-    parameter int unsigned AddrWidth = (NumWords > 32'd1) ? $clog2(NumWords) : 32'd1
+    parameter int unsigned AddrWidth = (NumWords > 32'd1) ? $clog2(NumWords) : 32'd1,
+    parameter int unsigned BeWidth = (DataWidth + 32'd7) / 32'd8
 ) (
     input logic clk_i,
     input logic rst_ni,
     // input ports
-    input logic req_i,
-    input logic we_i,
-    input logic [AddrWidth-1:0] addr_i,
-    input logic [31:0] wdata_i,
-    input logic [3:0] be_i,
+    input logic [NumPorts-1:0] req_i,
+    input logic [NumPorts-1:0] we_i,
+    input logic [NumPorts-1:0][AddrWidth-1:0] addr_i,
+    input logic [NumPorts-1:0][DataWidth-1:0] wdata_i,
+    input logic [NumPorts-1:0][BeWidth-1:0] be_i,
     // power manager signals that goes to the ASIC macros
     input logic pwrgate_ni,
     output logic pwrgate_ack_no,
     input logic set_retentive_ni,
     // output ports
-    output logic [31:0] rdata_o
+    output logic [NumPorts-1:0][DataWidth-1:0] rdata_o
 );
 
   tc_sram #(
       .NumWords (NumWords),
       .DataWidth(DataWidth),
-      .NumPorts (32'd1)
+      .NumPorts (NumPorts)
   ) tc_ram_i (
       .clk_i  (clk_i),
       .rst_ni (rst_ni),
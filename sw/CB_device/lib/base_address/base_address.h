@@ -17,6 +17,7 @@ extern "C" {
 //Define
 #define GLOBAL_BASE_ADDRESS 0x19000000	/*User defined*/
 #define SAFE_CSR_BASE_ADDRESS 0x20000000 /*User defined*/
+#define SYSTEM_BUS_TYPE 0x0 /*0 NtoM crossbar, 1 onetoM shared bus*/
 
 
 //Priv Reg
@@ -31,4 +32,17 @@ extern "C" {
 #define BOOT_OFFSET     (BOOT_DEBUG_ROM_BASEADDRESS | 0x0)
 #define DEBUG_OFFSET    (BOOT_DEBUG_ROM_BASEADDRESS | 0x50)
 
+//DMA
+#define DMA_BASEADDRESS (0x00011000 | GLOBAL_BASE_ADDRESS)
+
+//RAM
+#define RAM_BASEADDRESS (0x00020000 | GLOBAL_BASE_ADDRESS)
+#define RAM_NUM_BANKS   0x2
+#define RAM_BANK_SIZE   0x8000
+#define RAM_SIZE        0x10000
+
+//TCM (private per hart)
+#define TCM_BASEADDRESS (0x40000 | GLOBAL_BASE_ADDRESS)
+#define TCM_SIZE        0x00002000
+
 #endif
\ No newline at end of file
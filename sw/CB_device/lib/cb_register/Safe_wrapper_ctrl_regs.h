@@ -92,6 +92,277 @@ extern "C" {
 // DMR_REC
 #define SAFE_WRAPPER_CTRL_INITIAL_STACK_ADDR_REG_OFFSET 0x38
 
+// Exit status of the last finished job, written by _exit
+#define SAFE_WRAPPER_CTRL_EXIT_STATUS_REG_OFFSET 0x3c
+
+// Cycles between START and End_SW_Routine of the last job
+#define SAFE_WRAPPER_CTRL_CYCLE_COUNT_REG_OFFSET 0x40
+
+// Interrupt coalescing
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_REG_OFFSET 0x44
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_THRESHOLD_MASK 0xff
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_THRESHOLD_OFFSET 0
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_THRESHOLD_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_INTC_COALESCE_THRESHOLD_MASK, .index = SAFE_WRAPPER_CTRL_INTC_COALESCE_THRESHOLD_OFFSET })
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_TIMEOUT_MASK 0xffffff
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_TIMEOUT_OFFSET 8
+#define SAFE_WRAPPER_CTRL_INTC_COALESCE_TIMEOUT_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_INTC_COALESCE_TIMEOUT_MASK, .index = SAFE_WRAPPER_CTRL_INTC_COALESCE_TIMEOUT_OFFSET })
+
+// Coalesced_Jobs
+#define SAFE_WRAPPER_CTRL_COALESCED_JOBS_REG_OFFSET 0x48
+#define SAFE_WRAPPER_CTRL_COALESCED_JOBS_COALESCED_JOBS_MASK 0xff
+#define SAFE_WRAPPER_CTRL_COALESCED_JOBS_COALESCED_JOBS_OFFSET 0
+#define SAFE_WRAPPER_CTRL_COALESCED_JOBS_COALESCED_JOBS_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_COALESCED_JOBS_COALESCED_JOBS_MASK, .index = SAFE_WRAPPER_CTRL_COALESCED_JOBS_COALESCED_JOBS_OFFSET })
+
+// Warm_Boot
+#define SAFE_WRAPPER_CTRL_WARM_BOOT_REG_OFFSET 0x4c
+#define SAFE_WRAPPER_CTRL_WARM_BOOT_ENABLE_BIT 0
+
+// Warm start entry point (crt0 _warm_start)
+#define SAFE_WRAPPER_CTRL_WARM_ENTRY_REG_OFFSET 0x50
+
+// Checksum of the state reused by a warm start (.warm, .tcm image, .data,
+// .bss)
+#define SAFE_WRAPPER_CTRL_WARM_CHECKSUM_REG_OFFSET 0x54
+
+// System xbar priority per master, only the highest requesting level is
+// arbitrated. System wide: every group block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_QOS_PRIORITY_REG_OFFSET 0x58
+#define SAFE_WRAPPER_CTRL_QOS_PRIORITY_QOS_PRIORITY_MASK 0xffff
+#define SAFE_WRAPPER_CTRL_QOS_PRIORITY_QOS_PRIORITY_OFFSET 0
+#define SAFE_WRAPPER_CTRL_QOS_PRIORITY_QOS_PRIORITY_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_QOS_PRIORITY_QOS_PRIORITY_MASK, .index = SAFE_WRAPPER_CTRL_QOS_PRIORITY_QOS_PRIORITY_OFFSET })
+
+// System xbar weighted round robin, consecutive grants per master. System
+// wide: every group block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_QOS_WEIGHT_REG_OFFSET 0x5c
+
+// Bandwidth cap window in cycles, 0 disables the caps. System wide: every
+// group block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_REG_OFFSET 0x60
+#define SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_QOS_BW_WINDOW_MASK 0xffff
+#define SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_QOS_BW_WINDOW_OFFSET 0
+#define SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_QOS_BW_WINDOW_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_QOS_BW_WINDOW_MASK, .index = SAFE_WRAPPER_CTRL_QOS_BW_WINDOW_QOS_BW_WINDOW_OFFSET })
+
+// Max grants per window of masters 0 to 3, 0 is unlimited. System wide:
+// every group block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_QOS_BW_CAP0_REG_OFFSET 0x64
+
+// Max grants per window of masters 4 to 7, 0 is unlimited. System wide:
+// every group block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_QOS_BW_CAP1_REG_OFFSET 0x68
+
+// RAM SECDED control (sap_pkg::MEM_ECC). System wide: every group block
+// aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_ECC_CTRL_REG_OFFSET 0x6c
+#define SAFE_WRAPPER_CTRL_ECC_CTRL_SCRUB_EN_BIT 0
+
+// Corrected single bit RAM errors (saturating). System wide: every group
+// block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_ECC_CORRECTED_REG_OFFSET 0x70
+
+// Detected double bit RAM errors (saturating). System wide: every group
+// block aliases the group 0 register
+#define SAFE_WRAPPER_CTRL_ECC_UNCORRECTED_REG_OFFSET 0x74
+
+// Lockstep (DCLS delayed) configuration
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_REG_OFFSET 0x78
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_LOOSE_BIT 0
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_MASK 0xf
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_OFFSET 4
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_MASK, .index = SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_OFFSET })
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_MASK 0xffffff
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_OFFSET 8
+#define SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_MASK, .index = SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_OFFSET })
+
+// DCLS tie-break with the third hart on a data mismatch
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_REG_OFFSET 0x7c
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_EN_BIT 0
+
+// DCLS tie-break status
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_REG_OFFSET 0x80
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_LIVE_BIT 0
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_RESOLVED_BIT 1
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_FAULTY_MASK 0x7
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_FAULTY_OFFSET 4
+#define SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_FAULTY_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_FAULTY_MASK, .index = SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_FAULTY_OFFSET })
+
+// Written by Store_Checkpoint, data requests are counted from here
+#define SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_REG_OFFSET 0x84
+#define SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_STROBE_BIT 0
+
+// Voter/comparator mismatches on req per hart, saturating
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_REG_OFFSET 0x88
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART0_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART1_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART1_OFFSET 10
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART2_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART2_OFFSET 20
+#define SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_REQ_HART2_OFFSET })
+
+// Voter/comparator mismatches on addr per hart, saturating
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_REG_OFFSET 0x8c
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART0_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART1_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART1_OFFSET 10
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART2_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART2_OFFSET 20
+#define SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_ADDR_HART2_OFFSET })
+
+// Voter/comparator mismatches on we per hart, saturating
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_REG_OFFSET 0x90
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART0_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART1_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART1_OFFSET 10
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART2_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART2_OFFSET 20
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WE_HART2_OFFSET })
+
+// Voter/comparator mismatches on be per hart, saturating
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_REG_OFFSET 0x94
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART0_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART1_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART1_OFFSET 10
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART2_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART2_OFFSET 20
+#define SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_BE_HART2_OFFSET })
+
+// Voter/comparator mismatches on wdata per hart, saturating
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_REG_OFFSET 0x98
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART0_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART1_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART1_OFFSET 10
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART2_MASK 0x3ff
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART2_OFFSET 20
+#define SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_CNT_WDATA_HART2_OFFSET })
+
+// Mismatch ring buffer status
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_REG_OFFSET 0x9c
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_NEXT_MASK 0x3
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_NEXT_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_NEXT_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_STATUS_NEXT_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_STATUS_NEXT_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_VALID_MASK 0xf
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_VALID_OFFSET 4
+#define SAFE_WRAPPER_CTRL_TEL_RING_STATUS_VALID_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_STATUS_VALID_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_STATUS_VALID_OFFSET })
+
+// Mismatch ring buffer, {harts[7:5], fields[4:0]} per entry, fields {wdata,
+// be, we, addr, req}
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_REG_OFFSET 0xa0
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY0_MASK 0xff
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY0_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY0_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY0_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY0_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY1_MASK 0xff
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY1_OFFSET 8
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY1_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY1_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY1_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY2_MASK 0xff
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY2_OFFSET 16
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY2_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY2_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY2_OFFSET })
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY3_MASK 0xff
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY3_OFFSET 24
+#define SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY3_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY3_MASK, .index = SAFE_WRAPPER_CTRL_TEL_RING_INFO_ENTRY3_OFFSET })
+
+// Mismatch ring buffer entry 0: address of the mismatching request
+#define SAFE_WRAPPER_CTRL_TEL_RING_ADDR0_REG_OFFSET 0xa4
+
+// Mismatch ring buffer entry 1: address of the mismatching request
+#define SAFE_WRAPPER_CTRL_TEL_RING_ADDR1_REG_OFFSET 0xa8
+
+// Mismatch ring buffer entry 2: address of the mismatching request
+#define SAFE_WRAPPER_CTRL_TEL_RING_ADDR2_REG_OFFSET 0xac
+
+// Mismatch ring buffer entry 3: address of the mismatching request
+#define SAFE_WRAPPER_CTRL_TEL_RING_ADDR3_REG_OFFSET 0xb0
+
+// Mismatch ring buffer entry 0: Cycle_Count at the mismatch
+#define SAFE_WRAPPER_CTRL_TEL_RING_TIME0_REG_OFFSET 0xb4
+
+// Mismatch ring buffer entry 1: Cycle_Count at the mismatch
+#define SAFE_WRAPPER_CTRL_TEL_RING_TIME1_REG_OFFSET 0xb8
+
+// Mismatch ring buffer entry 2: Cycle_Count at the mismatch
+#define SAFE_WRAPPER_CTRL_TEL_RING_TIME2_REG_OFFSET 0xbc
+
+// Mismatch ring buffer entry 3: Cycle_Count at the mismatch
+#define SAFE_WRAPPER_CTRL_TEL_RING_TIME3_REG_OFFSET 0xc0
+
+// Mismatch telemetry clear
+#define SAFE_WRAPPER_CTRL_TEL_CLEAR_REG_OFFSET 0xc4
+#define SAFE_WRAPPER_CTRL_TEL_CLEAR_CLEAR_BIT 0
+
+// TCLS master failover
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_REG_OFFSET 0xc8
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_EN_BIT 0
+
+// TCLS master failover status
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_REG_OFFSET 0xcc
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_COUNT_MASK 0xff
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_COUNT_OFFSET 0
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_COUNT_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_COUNT_MASK, .index = SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_COUNT_OFFSET })
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_FAULTY_MASK 0x7
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_FAULTY_OFFSET 8
+#define SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_FAULTY_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_FAULTY_MASK, .index = SAFE_WRAPPER_CTRL_TMR_FAILOVER_STATUS_FAULTY_OFFSET })
+
+// Redundant mode entry
+#define SAFE_WRAPPER_CTRL_SYNC_CTRL_REG_OFFSET 0xd0
+#define SAFE_WRAPPER_CTRL_SYNC_CTRL_FAST_BIT 0
+
+// Redundant mode entry latency
+#define SAFE_WRAPPER_CTRL_SYNC_LATENCY_REG_OFFSET 0xd4
+
+// Voter/comparator checking outside critical sections, relaxes addr, be and
+// wdata only (req and we are always checked)
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_REG_OFFSET 0xd8
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_STORES_BIT 0
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_SAMPLE_BIT 1
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_MASK 0xff
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_OFFSET 8
+#define SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_FIELD \
+  ((bitfield_field32_t) { .mask = SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_MASK, .index = SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_OFFSET })
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
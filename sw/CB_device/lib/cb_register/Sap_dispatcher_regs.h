@@ -0,0 +1,49 @@
+// Generated register defines for sap_dispatcher
+
+// Copyright information found in source file:
+// Copyright lowRISC contributors.
+
+// Licensing information found in source file:
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _SAP_DISPATCHER_REG_DEFS_
+#define _SAP_DISPATCHER_REG_DEFS_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Register width
+#define SAP_DISPATCHER_PARAM_REG_WIDTH 32
+
+// Dispatcher control
+#define SAP_DISPATCHER_CTRL_REG_OFFSET 0x0
+#define SAP_DISPATCHER_CTRL_ENABLE_BIT 0
+#define SAP_DISPATCHER_CTRL_CLUSTER_MASK_MASK 0xff
+#define SAP_DISPATCHER_CTRL_CLUSTER_MASK_OFFSET 8
+#define SAP_DISPATCHER_CTRL_CLUSTER_MASK_FIELD \
+  ((bitfield_field32_t) { .mask = SAP_DISPATCHER_CTRL_CLUSTER_MASK_MASK, .index = SAP_DISPATCHER_CTRL_CLUSTER_MASK_OFFSET })
+
+// Entry address of a new job, pushed to the job queue on write
+#define SAP_DISPATCHER_JOB_SUBMIT_REG_OFFSET 0x4
+
+// Dispatcher status
+#define SAP_DISPATCHER_STATUS_REG_OFFSET 0x8
+#define SAP_DISPATCHER_STATUS_QUEUE_FULL_BIT 0
+#define SAP_DISPATCHER_STATUS_QUEUE_EMPTY_BIT 1
+#define SAP_DISPATCHER_STATUS_CLUSTERS_IDLE_MASK 0xff
+#define SAP_DISPATCHER_STATUS_CLUSTERS_IDLE_OFFSET 8
+#define SAP_DISPATCHER_STATUS_CLUSTERS_IDLE_FIELD \
+  ((bitfield_field32_t) { .mask = SAP_DISPATCHER_STATUS_CLUSTERS_IDLE_MASK, .index = SAP_DISPATCHER_STATUS_CLUSTERS_IDLE_OFFSET })
+
+// Number of jobs launched on a cluster
+#define SAP_DISPATCHER_JOBS_DISPATCHED_REG_OFFSET 0xc
+
+// Number of dispatched jobs finished (cluster back to sleep)
+#define SAP_DISPATCHER_JOBS_DONE_REG_OFFSET 0x10
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+#endif  // _SAP_DISPATCHER_REG_DEFS_
+// End generated register defines for sap_dispatcher
\ No newline at end of file
@@ -0,0 +1,62 @@
+// Generated register defines for sap_dma
+
+// Copyright information found in source file:
+// Copyright lowRISC contributors.
+
+// Licensing information found in source file:
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef _SAP_DMA_REG_DEFS_
+#define _SAP_DMA_REG_DEFS_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Register width
+#define SAP_DMA_PARAM_REG_WIDTH 32
+
+// Source address of the first descriptor (word aligned)
+#define SAP_DMA_SRC_ADDR_REG_OFFSET 0x0
+
+// Destination address of the first descriptor (word aligned)
+#define SAP_DMA_DST_ADDR_REG_OFFSET 0x4
+
+// Number of words of each row
+#define SAP_DMA_D1_LEN_REG_OFFSET 0x8
+#define SAP_DMA_D1_LEN_D1_LEN_MASK 0xffff
+#define SAP_DMA_D1_LEN_D1_LEN_OFFSET 0
+#define SAP_DMA_D1_LEN_D1_LEN_FIELD \
+  ((bitfield_field32_t) { .mask = SAP_DMA_D1_LEN_D1_LEN_MASK, .index = SAP_DMA_D1_LEN_D1_LEN_OFFSET })
+
+// Number of rows, 0 or 1 for a 1D transfer
+#define SAP_DMA_D2_LEN_REG_OFFSET 0xc
+#define SAP_DMA_D2_LEN_D2_LEN_MASK 0xffff
+#define SAP_DMA_D2_LEN_D2_LEN_OFFSET 0
+#define SAP_DMA_D2_LEN_D2_LEN_FIELD \
+  ((bitfield_field32_t) { .mask = SAP_DMA_D2_LEN_D2_LEN_MASK, .index = SAP_DMA_D2_LEN_D2_LEN_OFFSET })
+
+// Byte offset between the start of two source rows
+#define SAP_DMA_SRC_STRIDE_REG_OFFSET 0x10
+
+// Byte offset between the start of two destination rows
+#define SAP_DMA_DST_STRIDE_REG_OFFSET 0x14
+
+// Address of the next descriptor in memory, 0 ends the chain
+#define SAP_DMA_NEXT_DESC_REG_OFFSET 0x18
+
+// DMA control
+#define SAP_DMA_CTRL_REG_OFFSET 0x1c
+#define SAP_DMA_CTRL_START_BIT 0
+#define SAP_DMA_CTRL_IRQ_EN_BIT 1
+
+// DMA status
+#define SAP_DMA_STATUS_REG_OFFSET 0x20
+#define SAP_DMA_STATUS_BUSY_BIT 0
+#define SAP_DMA_STATUS_DONE_BIT 1
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+#endif  // _SAP_DMA_REG_DEFS_
+// End generated register defines for sap_dma
\ No newline at end of file
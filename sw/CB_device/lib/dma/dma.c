@@ -0,0 +1,64 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+#include "dma.h"
+
+#define DMA_REG(offset) (*(volatile uint32_t *)(DMA_BASEADDRESS + (offset)))
+
+void DMA_Start(const dma_desc_t *desc, unsigned int irq_en){
+        //Wait until the previous chain has finished
+        DMA_Wait();
+        DMA_Clear_Done();
+
+        DMA_REG(SAP_DMA_SRC_ADDR_REG_OFFSET)   = desc->src;
+        DMA_REG(SAP_DMA_DST_ADDR_REG_OFFSET)   = desc->dst;
+        DMA_REG(SAP_DMA_D1_LEN_REG_OFFSET)     = desc->d1_len;
+        DMA_REG(SAP_DMA_D2_LEN_REG_OFFSET)     = desc->d2_len;
+        DMA_REG(SAP_DMA_SRC_STRIDE_REG_OFFSET) = desc->src_stride;
+        DMA_REG(SAP_DMA_DST_STRIDE_REG_OFFSET) = desc->dst_stride;
+        DMA_REG(SAP_DMA_NEXT_DESC_REG_OFFSET)  = (uint32_t)desc->next;
+
+        //Descriptors in memory have to be visible before the DMA fetches them
+        asm volatile("fence");
+        DMA_REG(SAP_DMA_CTRL_REG_OFFSET) = (1 << SAP_DMA_CTRL_START_BIT) |
+                                           ((irq_en & 0x1) << SAP_DMA_CTRL_IRQ_EN_BIT);
+}
+
+void DMA_Copy(void *dst, const void *src, uint32_t words){
+        DMA_Copy_2D(dst, src, words, 1, 0, 0);
+}
+
+void DMA_Copy_2D(void *dst, const void *src, uint32_t words, uint32_t rows,
+                 uint32_t src_stride, uint32_t dst_stride){
+        dma_desc_t desc = {
+                .src = (uint32_t)src,
+                .dst = (uint32_t)dst,
+                .d1_len = words,
+                .d2_len = rows,
+                .src_stride = src_stride,
+                .dst_stride = dst_stride,
+                .next = 0
+        };
+
+        DMA_Start(&desc, DMA_IRQ_DISABLE);
+        DMA_Wait();
+}
+
+unsigned int DMA_Busy(void){
+        return (DMA_REG(SAP_DMA_STATUS_REG_OFFSET) >> SAP_DMA_STATUS_BUSY_BIT) & 0x1;
+}
+
+void DMA_Wait(void){
+        while (DMA_Busy());
+}
+
+void DMA_Clear_Done(void){
+        DMA_REG(SAP_DMA_STATUS_REG_OFFSET) = 0;
+}
+
+__attribute__((weak, aligned(4), interrupt)) void handler_irq_dma(void){
+        //Level interrupt, clear DONE to release the line
+        DMA_REG(SAP_DMA_STATUS_REG_OFFSET) = 0;
+}
@@ -0,0 +1,49 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+#ifndef _DMA_H_
+#define _DMA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "base_address.h"
+#include "Sap_dma_regs.h"
+
+//Descriptor, same layout as the DMA registers SRC_ADDR..NEXT_DESC
+//Addresses and strides in bytes (word aligned), lengths in words
+typedef struct dma_desc {
+        uint32_t src;
+        uint32_t dst;
+        uint32_t d1_len;
+        uint32_t d2_len;            //0 or 1 -> 1D transfer
+        uint32_t src_stride;
+        uint32_t dst_stride;
+        struct dma_desc *next;      //NULL ends the chain
+} __attribute__((aligned(4))) dma_desc_t;
+
+#define DMA_IRQ_DISABLE 0
+#define DMA_IRQ_ENABLE  1
+
+//Functions
+void DMA_Start(const dma_desc_t *desc, unsigned int irq_en);
+void DMA_Copy(void *dst, const void *src, uint32_t words);
+void DMA_Copy_2D(void *dst, const void *src, uint32_t words, uint32_t rows,
+                 uint32_t src_stride, uint32_t dst_stride);
+unsigned int DMA_Busy(void);
+void DMA_Wait(void);
+void DMA_Clear_Done(void);
+
+//Handler fast interrupt 20, taken by the hart (TCLS/DCLS group) that called
+//DMA_Start, weak so the application can override it
+__attribute__((aligned(4), interrupt)) void handler_irq_dma(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
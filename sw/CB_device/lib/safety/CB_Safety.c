@@ -748,6 +748,23 @@ void Store_Checkpoint(void){
         //Reference for exit store_checkpoint 
         asm volatile(".global _exit_Store_checkpoint");
         asm volatile("_exit_Store_checkpoint:");      
+
+        //Checkpoint mark for the DCLS tie-break, also run after a restore
+        asm volatile("addi sp,sp,-4");
+        asm volatile("sw   t6,0(sp)");
+        asm volatile("li   t6, %0" : : "i" (SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_DMR_CHECKPOINT_REG_OFFSET));
+        asm volatile("sw   zero,0(t6)");
+        asm volatile("lw   t6,0(sp)");
+        asm volatile("addi sp,sp,4");
+}
+
+void handler_dmr_tiebreak(void){
+        volatile unsigned int *Tiebreak_Status = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_REG_OFFSET;
+
+        Store_Checkpoint();
+        //Third hart: the pair resumes from this checkpoint and returns, it stays asleep
+        if (*Tiebreak_Status & (1 << SAFE_WRAPPER_CTRL_DMR_TIEBREAK_STATUS_LIVE_BIT))
+                while (1) asm volatile("wfi");
 }
 
 
@@ -869,9 +886,50 @@ void Check_RF(void){
 }
 
 
-//Todo adapt this exit to the exit syscall and exit_status
+//Warm restart
+//Job called by crt0 _warm_start, kept in the checksummed .warm section
+__warm warm_job_t __warm_job;
+
+static unsigned int Warm_Checksum_Range(unsigned int sum, unsigned int *start, unsigned int *end){
+        for (unsigned int *p = start; p < end; p++)
+                sum = ((sum << 5) | (sum >> 27)) + *p;
+        return sum;
+}
+
+//Everything _warm_start reuses without reinitialising it: .warm, the .tcm load
+//image (copied again to the TCM) and .data/.sdata/.sbss/.bss
+unsigned int Warm_Checksum(void){
+        unsigned int sum = 0x5A5A5A5A;
+        sum = Warm_Checksum_Range(sum, __warm_start, __warm_end);
+        sum = Warm_Checksum_Range(sum, __tcm_load_start, __tcm_load_start + (__tcm_end - __tcm_start));
+        sum = Warm_Checksum_Range(sum, __warm_data_start, __bss_end);
+        return sum;
+}
+
+void Warm_Register_Job(warm_job_t job){
+        volatile unsigned int *Safe_wrapper_ctrl = SAFE_WRAPPER_CTRL_BASEADDRESS;
+        __warm_job = job;
+        Safe_wrapper_ctrl[SAFE_WRAPPER_CTRL_WARM_CHECKSUM_REG_OFFSET/4] = Warm_Checksum();
+        Safe_wrapper_ctrl[SAFE_WRAPPER_CTRL_WARM_ENTRY_REG_OFFSET/4] = (unsigned int)_warm_start;
+        Safe_wrapper_ctrl[SAFE_WRAPPER_CTRL_WARM_BOOT_REG_OFFSET/4] = 0x1;
+}
+
+void Warm_Disable(void){
+        volatile unsigned int *WARM_BOOT_P = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_WARM_BOOT_REG_OFFSET;
+        *WARM_BOOT_P = 0x0;
+}
+
+//Exit status and End_SW for the host (completion interrupt, coalesced by INTC_COALESCE)
 __attribute__((aligned(4))) void _exit(int exit_status){
+    volatile unsigned int *EXIT_STATUS_P = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_EXIT_STATUS_REG_OFFSET;
     volatile unsigned int *END_SW_P = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_END_SW_ROUTINE_REG_OFFSET;
+    volatile unsigned int *WARM_BOOT_P = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_WARM_BOOT_REG_OFFSET;
+    volatile unsigned int *WARM_CHECKSUM_P = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_WARM_CHECKSUM_REG_OFFSET;
+    //The job may have updated the preserved state, seal it for the next warm start
+    if (*WARM_BOOT_P)
+        *WARM_CHECKSUM_P = Warm_Checksum();
+    //Exit status first, End_SW raises the completion interrupt and freezes CYCLE_COUNT
+    *EXIT_STATUS_P = (unsigned int)exit_status;
     *END_SW_P = 0x1;
     asm volatile("fence");
     asm volatile("wfi");
@@ -33,15 +33,76 @@ __attribute__((aligned(4))) void Safe_Stop(unsigned int master);
 __attribute__((aligned(4),always_inline)) inline void Set_Critical_Section(unsigned int critical){
         volatile unsigned int *Priv_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_CRITICAL_SECTION_REG_OFFSET;
         *Priv_Reg = critical;}
+//Loose lockstep for LOCKSTEP_MODE, set before Safe_Activate. interval: data requests between signature checks
+__attribute__((aligned(4),always_inline)) inline void Set_Lockstep_Loose(unsigned int loose, unsigned int interval){
+        volatile unsigned int *Lockstep_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_REG_OFFSET;
+        *Lockstep_Reg = (*Lockstep_Reg & (SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_MASK << SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_OFFSET)) |
+                        (loose << SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_LOOSE_BIT) |
+                        ((interval & SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_MASK) << SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_INTERVAL_OFFSET);}
+//Tight lockstep delay for LOCKSTEP_MODE, set before Safe_Activate. delay: 1..NCYCLES cycles
+__attribute__((aligned(4),always_inline)) inline void Set_Lockstep_Delay(unsigned int delay){
+        volatile unsigned int *Lockstep_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_REG_OFFSET;
+        *Lockstep_Reg = (*Lockstep_Reg & ~(SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_MASK << SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_OFFSET)) |
+                        ((delay & SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_MASK) << SAFE_WRAPPER_CTRL_LOCKSTEP_CTRL_DELAY_OFFSET);}
+//DCLS tie-break: on a data mismatch the third hart replays from the last Store_Checkpoint
+__attribute__((aligned(4),always_inline)) inline void Set_Dmr_Tiebreak(unsigned int enable){
+        volatile unsigned int *Tiebreak_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_DMR_TIEBREAK_REG_OFFSET;
+        *Tiebreak_Reg = enable << SAFE_WRAPPER_CTRL_DMR_TIEBREAK_EN_BIT;}
+//Mismatch telemetry: counters per hart/field (Tel_Cnt_*) and ring of the last 4 mismatches (Tel_Ring_*)
+__attribute__((aligned(4),always_inline)) inline void Telemetry_Clear(void){
+        volatile unsigned int *Tel_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_TEL_CLEAR_REG_OFFSET;
+        *Tel_Reg = 1 << SAFE_WRAPPER_CTRL_TEL_CLEAR_CLEAR_BIT;}
+//TCLS failover: an outvoted master is replaced on the fly, Master_core is updated by hardware
+__attribute__((aligned(4),always_inline)) inline void Set_Tmr_Failover(unsigned int enable){
+        volatile unsigned int *Failover_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_TMR_FAILOVER_REG_OFFSET;
+        *Failover_Reg = enable << SAFE_WRAPPER_CTRL_TMR_FAILOVER_EN_BIT;}
+//Current master, pass it to Safe_Stop after a failover
+__attribute__((aligned(4),always_inline)) inline unsigned int Get_Master_Core(void){
+        volatile unsigned int *Master_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_MASTER_CORE_REG_OFFSET;
+        return *Master_Reg;}
+//Fast entry, set before Safe_Activate: the slaves restore while the master stores its context
+__attribute__((aligned(4),always_inline)) inline void Set_Fast_Sync(unsigned int enable){
+        volatile unsigned int *Sync_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_SYNC_CTRL_REG_OFFSET;
+        *Sync_Reg = enable << SAFE_WRAPPER_CTRL_SYNC_CTRL_FAST_BIT;}
+//Cycles of the last entry, from the switch request to the synchronized start
+__attribute__((aligned(4),always_inline)) inline unsigned int Get_Sync_Latency(void){
+        volatile unsigned int *Latency_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_SYNC_LATENCY_REG_OFFSET;
+        return *Latency_Reg;}
+//Checking outside critical sections: stores only (instruction bus always), and/or one transaction out of nth
+__attribute__((aligned(4),always_inline)) inline void Set_Check_Policy(unsigned int stores, unsigned int sample, unsigned int nth){
+        volatile unsigned int *Policy_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_CHECK_POLICY_REG_OFFSET;
+        *Policy_Reg = (stores << SAFE_WRAPPER_CTRL_CHECK_POLICY_STORES_BIT) |
+                      (sample << SAFE_WRAPPER_CTRL_CHECK_POLICY_SAMPLE_BIT) |
+                      ((nth & SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_MASK) << SAFE_WRAPPER_CTRL_CHECK_POLICY_NTH_OFFSET);}
         
 __attribute__((aligned(4))) void Store_Checkpoint(void);
 __attribute__((aligned(4))) void Check_RF(void);
 
+//Warm restart
+//Data preserved between jobs. WARM_CHECKSUM covers .warm, the .tcm load image
+//and .data/.bss, which _warm_start reuses as left by the previous job
+#define __warm __attribute__((section(".warm")))
+typedef void (*warm_job_t)(void);
+extern unsigned int __warm_start[], __warm_end[], __warm_data_start[], __bss_end[];
+void _warm_start(void);
+
+unsigned int Warm_Checksum(void);
+void Warm_Register_Job(warm_job_t job);
+void Warm_Disable(void);
+
+//Tightly coupled memory
+//Code/data copied by crt0 to the private TCM of the booting hart (sap_pkg::TCM_ENABLE)
+//Single mode only: the slaves of TMR/DCLS have an empty TCM and Safe_Activate,
+//rollback and failover do not sync it, so no __tcm code/data in redundant modes
+#define __tcm __attribute__((section(".tcm")))
+extern unsigned int __tcm_start[], __tcm_end[], __tcm_load_start[];
+
 //Handlers
 INTERRUPT_HANDLER_ABI void handler_tmr_recoverysync(void);
 INTERRUPT_HANDLER_ABI void handler_tmr_dmcontext_copy(void);
 INTERRUPT_HANDLER_ABI void handler_tmr_dmshsync(void);
 INTERRUPT_HANDLER_ABI void handler_safe_fsm(void);
+INTERRUPT_HANDLER_ABI void handler_dmr_tiebreak(void);
 
 
 #endif  
@@ -0,0 +1,112 @@
+// Copyright 2025 CEI UPM
+// Solderpad Hardware License, Version 2.1, see LICENSE.md for details.
+// SPDX-License-Identifier: Apache-2.0 WITH SHL-2.1
+// Luis Waucquez (luis.waucquez.jimenez@upm.es)
+
+// System bus benchmark: cycles per workload in every execution mode.
+// `make bus-bench` (util/bus_bench.sh) builds and runs it in the Verilator
+// simulation for every SystemBus.BusType, to compare the NtoM crossbar with
+// the onetoM bus.
+// Cycles are read from the CYCLE_COUNT CSR so every hart sees the same value.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "CB_Safety.h"
+#include "dma.h"
+
+#define BUF_WORDS       256
+#define FETCH_ITER      512
+#define STRIDE_ITER     256
+
+#define N_MODES         4
+#define N_WORKLOADS     5
+
+static uint32_t src[BUF_WORDS];
+static uint32_t dst[BUF_WORDS];
+static uint32_t dma_dst[BUF_WORDS];
+
+static unsigned int cycles[N_MODES][N_WORKLOADS];
+
+static const unsigned int modes[N_MODES] = {SINGLE_MODE, TCLS_MODE, DCLS_MODE, LOCKSTEP_MODE};
+static const char *mode_name[N_MODES] = {"SINGLE", "TCLS", "DCLS", "LOCKSTEP"};
+static const char *workload_name[N_WORKLOADS] = {"fetch", "copy", "read_stride", "write",
+                                                 "copy_dma"};
+
+static inline unsigned int Cycle_Count(void){
+        volatile unsigned int *Cycle_Reg = SAFE_WRAPPER_CTRL_BASEADDRESS | SAFE_WRAPPER_CTRL_CYCLE_COUNT_REG_OFFSET;
+        return *Cycle_Reg;}
+
+//Instruction fetch: ALU loop, no data accesses
+static uint32_t Wl_Fetch(void){
+        uint32_t acc = 1;
+        for (unsigned int i = 0; i < FETCH_ITER; i++)
+                acc = (acc << 1) ^ (acc >> 3) ^ i;
+        return acc;
+}
+
+//Word copy RAM -> RAM
+static uint32_t Wl_Copy(void){
+        for (unsigned int i = 0; i < BUF_WORDS; i++)
+                dst[i] = src[i];
+        return dst[BUF_WORDS - 1];
+}
+
+//Reads one bank size apart: every access to the same bank when contiguous
+static uint32_t Wl_Read_Stride(void){
+        volatile uint32_t *ram = (volatile uint32_t *)RAM_BASEADDRESS;
+        uint32_t acc = 0;
+        for (unsigned int i = 0; i < STRIDE_ITER; i++)
+                acc += ram[((i * (RAM_BANK_SIZE / 4 + 1)) % (RAM_SIZE / 4))];
+        return acc;
+}
+
+//Back to back stores
+static uint32_t Wl_Write(void){
+        for (unsigned int i = 0; i < BUF_WORDS; i++)
+                dst[i] = i;
+        return dst[0];
+}
+
+//Word copy while the DMA copies another buffer
+static uint32_t Wl_Copy_Dma(void){
+        DMA_Copy(dma_dst, src, BUF_WORDS);
+        Wl_Copy();
+        DMA_Wait();
+        DMA_Clear_Done();
+        return dma_dst[BUF_WORDS - 1];
+}
+
+static uint32_t (*const workloads[N_WORKLOADS])(void) = {Wl_Fetch, Wl_Copy, Wl_Read_Stride,
+                                                          Wl_Write, Wl_Copy_Dma};
+
+int main(void)
+{
+        unsigned int start;
+        uint32_t check = 0;
+
+        for (unsigned int i = 0; i < BUF_WORDS; i++)
+                src[i] = i * 0x01010101;
+
+        for (unsigned int m = 0; m < N_MODES; m++) {
+                if (modes[m] != SINGLE_MODE)
+                        Safe_Activate(modes[m]);
+
+                for (unsigned int w = 0; w < N_WORKLOADS; w++) {
+                        start = Cycle_Count();
+                        check ^= workloads[w]();
+                        cycles[m][w] = Cycle_Count() - start;
+                }
+
+                if (modes[m] != SINGLE_MODE)
+                        Safe_Stop(Get_Master_Core());
+        }
+
+        printf("bus_bench: bus %s, %d banks\n", SYSTEM_BUS_TYPE ? "onetoM" : "NtoM", RAM_NUM_BANKS);
+        for (unsigned int m = 0; m < N_MODES; m++)
+                for (unsigned int w = 0; w < N_WORKLOADS; w++)
+                        printf("%s %s %u\n", mode_name[m], workload_name[w], cycles[m][w]);
+        printf("check %x\n", (unsigned int)check);
+
+        return EXIT_SUCCESS;
+}
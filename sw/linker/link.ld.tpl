@@ -20,13 +20,16 @@ MEMORY
   /* Our testbench is a bit weird in that we initialize the RAM (thus
      allowing initialized sections to be placed there). Infact we dump all
      sections to ram. */
-  ram0 (rwxai) : ORIGIN = ${SystemBus.BaseAddress} + 0x00020000, LENGTH = 0x000008000
-  ram1 (rwxai) : ORIGIN = ${SystemBus.BaseAddress} + 0x00028000, LENGTH = 0x000008000
+  ram0 (rwxai) : ORIGIN = ${SystemBus.BaseAddress} + 0x00020000, LENGTH = ${Memory.HalfSize}
+  ram1 (rwxai) : ORIGIN = ${SystemBus.BaseAddress} + ${Memory.Ram1Offset}, LENGTH = ${Memory.HalfSize}
+  /* per-hart scratchpad (sap_pkg::TCM_ENABLE), loaded from ram1 by crt0, single mode only */
+  tcm (rwxai) : ORIGIN = ${SystemBus.BaseAddress} + ${Memory.TcmOffset}, LENGTH = 0x000002000
 }
 
 /*
  * This linker script try to put data in ram1 and code
- * in ram0.
+ * in ram0. ram0 and ram1 are the two halves of the RAM
+ * (Memory.NumBanks * Memory.BankSize in configs/addr.hjson).
 */
 
 SECTIONS
@@ -210,10 +213,32 @@ SECTIONS
   /* .dynamic        : { *(.dynamic) } */
   . = DATA_SEGMENT_RELRO_END (0, .);
 
+  /* data preserved across warm restarts, covered by WARM_CHECKSUM together
+     with the .tcm load image and __warm_data_start..__bss_end */
+  .warm           : ALIGN(4)
+  {
+    PROVIDE(__warm_start = .);
+    KEEP(*(.warm .warm.*))
+    . = ALIGN(4);
+    PROVIDE(__warm_end = .);
+  } >ram1
+
+  /* code and data placed in the hart TCM with __tcm, copied by crt0 on the
+     booting hart only: not usable in TMR/DCLS */
+  .tcm            : ALIGN(4)
+  {
+    PROVIDE(__tcm_start = .);
+    *(.tcm .tcm.*)
+    . = ALIGN(4);
+    PROVIDE(__tcm_end = .);
+  } >tcm AT>ram1
+  PROVIDE(__tcm_load_start = LOADADDR(.tcm));
+
   /* data sections for initalized data */
   .data           :
   {
     __DATA_BEGIN__ = .;
+    PROVIDE(__warm_data_start = .);
     *(.data .data.* .gnu.linkonce.d.*)
     SORT(CONSTRUCTORS)
   } >ram1
@@ -0,0 +1,41 @@
+#!/bin/bash
+# Builds and runs sw/applications/bus_bench for every system bus configuration
+# (SystemBus.BusType 0 NtoM crossbar, 1 onetoM shared bus) and keeps one report
+# per configuration in build/bus_bench/. configs/addr.hjson is restored at the end.
+#
+# The simulation model belongs to the SoC that vendors SAP:
+#   SIM_BUILD  command that rebuilds the model after sap_gen.py (run in SOC_DIR)
+#   SIM_RUN    command that runs it, +firmware=<hex> is appended (run in SOC_DIR)
+# Usage (from the repo root): SOC_DIR=<soc> util/bus_bench.sh
+
+set -e
+
+SAP_DIR=$(realpath "$(dirname "$0")/..")
+SOC_DIR=${SOC_DIR:-$SAP_DIR/../../..}
+SIM_BUILD=${SIM_BUILD:-make verilator-sim}
+SIM_RUN=${SIM_RUN:-./build/openhwgroup.org_systems_core-v-mini-mcu_0/sim-verilator/Vtestharness}
+PYTHON=${PYTHON:-python3}
+BUS_TYPES=${BUS_TYPES:-"0 1"}
+
+CONFIG=$SAP_DIR/configs/addr.hjson
+OUT_DIR=$SAP_DIR/build/bus_bench
+mkdir -p "$OUT_DIR"
+
+cp "$CONFIG" "$OUT_DIR/addr.hjson.orig"
+restore() {
+    cp "$OUT_DIR/addr.hjson.orig" "$CONFIG"
+    (cd "$SAP_DIR" && $PYTHON util/sap_gen.py > /dev/null)
+}
+trap restore EXIT
+
+for bus in $BUS_TYPES; do
+    echo "bus_bench: SystemBus.BusType = $bus"
+    sed -i -E "s/^(\s*BusType:\s*)[0-9]+/\1$bus/" "$CONFIG"
+    (cd "$SAP_DIR" && $PYTHON util/sap_gen.py)
+    make -C "$SAP_DIR" app-cbcore PROJECT=bus_bench
+    (cd "$SOC_DIR" && $SIM_BUILD)
+    (cd "$SOC_DIR" && $SIM_RUN +firmware="$SAP_DIR/sw/build/main.hex") | tee "$OUT_DIR/bus_type_$bus.log"
+done
+
+echo "bus_bench: reports in $OUT_DIR"
+grep -h "bus_bench:\|^check" "$OUT_DIR"/bus_type_*.log || true
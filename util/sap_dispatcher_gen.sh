@@ -0,0 +1,5 @@
+echo "Generating RTL"
+${PYTHON} ../../esl_epfl_x_heep/hw/vendor/pulp_platform_register_interface/vendor/lowrisc_opentitan/util/regtool.py -r -t ../rtl ../data/sap_dispatcher.hjson
+mv ../rtl/sap_dispatcher_reg_pkg.sv ../rtl/include
+echo "Generating SW"
+${PYTHON} ../../esl_epfl_x_heep/hw/vendor/pulp_platform_register_interface/vendor/lowrisc_opentitan/util/regtool.py --cdefines -o ../sw/CB_device/lib/cb_register/Sap_dispatcher_regs.h ../data/sap_dispatcher.hjson
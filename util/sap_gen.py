@@ -7,6 +7,10 @@ Script to generate:
 by replacing placeholders `${section.subsection}` with hex values
 (SV templates assume `32'h` prefix in file; all others receive `0x` prefix).
 
+The memory map values derived from Memory.NumBanks and Memory.BankSize
+(Memory.Size, HalfSize, Ram1Offset, TcmOffset, ClusterStride) are computed
+here and checked against the external bus window.
+
 Usage:
     $ python generate_files.py
 
@@ -47,6 +51,63 @@ def to_hex_string(val):
     return s.upper()
 
 
+# Fixed offsets from SystemBus.BaseAddress (see sap_pkg.sv.tpl)
+MEMORY_OFFSET = 0x20000
+TCM_MIN_OFFSET = 0x40000
+TCM_SIZE = 0x2000
+CLUSTER_MIN_STRIDE = 0x100000
+MAX_CLUSTERS = 8  # sap_pkg::MAX_CLUSTERS
+
+
+def to_int(val):
+    if isinstance(val, int):
+        return val
+    return int(str(val).strip().strip('"').strip("'"), 0)
+
+
+def is_pow2(val):
+    return val > 0 and (val & (val - 1)) == 0
+
+
+def derive_memory_map(cfg):
+    mem = cfg['Memory']
+    banks = to_int(mem['NumBanks'])
+    bank_size = to_int(mem['BankSize'])
+    layout = to_int(mem['Layout'])
+
+    if to_int(cfg['SystemBus'].get('BusType', 0)) not in (0, 1):
+        raise ValueError("SystemBus.BusType must be 0 (NtoM) or 1 (onetoM)")
+    if not is_pow2(bank_size):
+        raise ValueError(f"Memory.BankSize 0x{bank_size:X} is not a power of 2")
+    if layout != 0 and not is_pow2(banks):
+        raise ValueError(f"Memory.NumBanks {banks} must be a power of 2 when interleaved")
+
+    size = banks * bank_size
+    mem_end = MEMORY_OFFSET + size
+    # TCM after the RAM, aligned to 64KB
+    tcm_offset = max(TCM_MIN_OFFSET, (mem_end + 0xFFFF) & ~0xFFFF)
+    stride = CLUSTER_MIN_STRIDE
+    while stride < tcm_offset + TCM_SIZE:
+        stride <<= 1
+
+    base = to_int(cfg['SystemBus']['BaseAddress'])
+    ext_start = to_int(cfg['MMAcceleratorOrExternalBus']['BaseAddress'])
+    ext_end = ext_start + to_int(cfg['MMAcceleratorOrExternalBus']['Size'])
+    for name, start, end in (('RAM', base + MEMORY_OFFSET, base + mem_end),
+                             ('TCM', base + tcm_offset, base + tcm_offset + TCM_SIZE),
+                             ('Cluster windows', base, base + MAX_CLUSTERS * stride)):
+        if start < ext_end and ext_start < end:
+            raise ValueError(f"{name} [0x{start:08X}, 0x{end:08X}) overlaps the external bus "
+                             f"[0x{ext_start:08X}, 0x{ext_end:08X}), move "
+                             "MMAcceleratorOrExternalBus.BaseAddress")
+
+    mem['Size'] = size
+    mem['HalfSize'] = size // 2
+    mem['Ram1Offset'] = MEMORY_OFFSET + size // 2
+    mem['TcmOffset'] = tcm_offset
+    mem['ClusterStride'] = stride
+
+
 def process_template(template_path: Path, cfg: dict):
     content = template_path.read_text()
     # Choose prefix: no 0x for SV templates (SV file includes 32'h), 0x for others
@@ -85,6 +146,12 @@ def main():
         print(f"Error parsing HJSON: {e}", file=sys.stderr)
         sys.exit(1)
 
+    try:
+        derive_memory_map(cfg)
+    except (KeyError, ValueError) as e:
+        print(f"Error in memory configuration: {e}", file=sys.stderr)
+        sys.exit(1)
+
     templates = [
         Path('rtl/include/sap_pkg.sv.tpl'),
         Path('sw/linker/link.ld.tpl'),
@@ -8,8 +8,10 @@ module sap_top_wrapper
   import reg_pkg::*;
   import sap_pkg::*;
 #(
-    parameter NHARTS  = 3,
-    parameter N_BANKS = 2,
+    parameter NHARTS  = sap_pkg::NHARTS,
+    parameter N_BANKS = sap_pkg::NUM_BANKS,
+    //Asynchronous boundary between clk_i (host) and clk_core_i (sap_top)
+    parameter CDC     = 0,
     parameter type obi_req_t            = logic,
     parameter type obi_resp_t           = logic
 ) (
@@ -17,6 +19,10 @@ module sap_top_wrapper
     input logic clk_i,
     input logic rst_ni,
 
+    // Core clock, only used when CDC = 1. Defaulted so the existing single
+    // clock instantiations (CDC = 0) do not have to connect it.
+    input logic clk_core_i = 1'b0,
+
     // Top level clock gating unit enable
     input logic en_i,
 
@@ -46,12 +52,58 @@ module sap_top_wrapper
     output logic interrupt_o
 );
 
+  // Core clock domain
+  logic clk_core, rst_core_n, en_core;
+
+  obi_req_t  core_master_req;
+  obi_resp_t core_master_resp;
+  obi_req_t  core_slave_req;
+  obi_resp_t core_slave_resp;
+  reg_req_t  core_csr_req;
+  reg_rsp_t  core_csr_resp;
+  logic core_debug_req;
+  logic [NHARTS-1:0] core_sleep;
+  logic core_interrupt;
+
+  sap_cdc #(
+    .obi_req_t            (obi_req_t  ),
+    .obi_resp_t           (obi_resp_t ),
+    .CDC                  (CDC        ),
+    .NSLEEP               (NHARTS     )
+  ) sap_cdc_i (
+      .host_clk_i(clk_i),
+      .host_rst_ni(rst_ni),
+      .host_en_i(en_i),
+      .host_master_req_i(ext_master_req_i),
+      .host_master_resp_o(ext_master_resp_o),
+      .host_slave_req_o(ext_slave_req_o),
+      .host_slave_resp_i(ext_slave_resp_i),
+      .host_csr_req_i(csr_reg_req_i),
+      .host_csr_resp_o(csr_reg_resp_o),
+      .host_debug_req_i(debug_req_i),
+      .host_sleep_o(sleep_o),
+      .host_interrupt_o(interrupt_o),
+      .core_clk_i(clk_core_i),
+      .core_clk_o(clk_core),
+      .core_rst_no(rst_core_n),
+      .core_en_o(en_core),
+      .core_master_req_o(core_master_req),
+      .core_master_resp_i(core_master_resp),
+      .core_slave_req_i(core_slave_req),
+      .core_slave_resp_o(core_slave_resp),
+      .core_csr_req_o(core_csr_req),
+      .core_csr_resp_i(core_csr_resp),
+      .core_debug_req_o(core_debug_req),
+      .core_sleep_i(core_sleep),
+      .core_interrupt_i(core_interrupt)
+  );
+
   logic clk_cg;
 
   sap_clock_gate sap_clock_gate_i (
-      .clk_i    (clk_i),
+      .clk_i    (clk_core),
       .test_en_i(1'b0),
-      .en_i     (en_i),
+      .en_i     (en_core),
       .clk_o    (clk_cg)
   );
 
@@ -62,19 +114,19 @@ module sap_top_wrapper
     .obi_resp_t           (obi_resp_t )
   ) sap_top_i (
       .clk_i(clk_cg),
-      .rst_ni,
-      .ext_master_req_i,
-      .ext_master_resp_o,
-      .ext_slave_req_o,
-      .ext_slave_resp_i,
-      .csr_reg_req_i,
-      .csr_reg_resp_o,
-      .debug_req_i,
+      .rst_ni(rst_core_n),
+      .ext_master_req_i(core_master_req),
+      .ext_master_resp_o(core_master_resp),
+      .ext_slave_req_o(core_slave_req),
+      .ext_slave_resp_i(core_slave_resp),
+      .csr_reg_req_i(core_csr_req),
+      .csr_reg_resp_o(core_csr_resp),
+      .debug_req_i(core_debug_req),
       .pwrgate_ni,
       .pwrgate_ack_no,
       .set_retentive_ni,
-      .sleep_o,
-      .interrupt_o
+      .sleep_o(core_sleep),
+      .interrupt_o(core_interrupt)
   );
 
 endmodule